@@ -0,0 +1,68 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+/* Minimal stand-in for the Teensy core's Arduino.h, just large enough to
+ * compile the display library and node tree on a host machine. Time is
+ * simulated: delay() advances the millis()/micros() clock instead of sleeping,
+ * and so does every byte the emulated panels clock over SPI, so host runs of
+ * begin() are instantaneous but still report how long the hardware would have
+ * taken.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cstdio>
+
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+namespace host {
+// Time spent in delays; see ILI9341_Emulator::nanos() for the full clock
+extern uint32_t g_micros;
+uint64_t nanos();
+}  // namespace host
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t val) {}
+inline uint8_t digitalReadFast(uint8_t pin) { return HIGH; }
+inline void delayMicroseconds(uint32_t usec) { host::g_micros += usec; }
+inline void delay(uint32_t msec) { host::g_micros += msec * 1000; }
+inline uint32_t micros() { return host::nanos() / 1000; }
+inline uint32_t millis() { return host::nanos() / 1000000; }
+
+class Print {
+ public:
+  virtual ~Print() = default;
+
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t count = 0;
+    while (size--) {
+      count += write(*buffer++);
+    }
+    return count;
+  }
+
+  size_t print(const char* s) {
+    return write(reinterpret_cast<const uint8_t*>(s), strlen(s));
+  }
+  size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+  size_t print(int n) {
+    char buf[12];
+    std::snprintf(buf, sizeof(buf), "%d", n);
+    return print(buf);
+  }
+  size_t println() { return write('\n'); }
+  size_t println(const char* s) { return print(s) + println(); }
+};
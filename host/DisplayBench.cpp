@@ -0,0 +1,513 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+/* @desc Host-side display benchmark. Renders the dash and menu screens into
+ *       two emulated ILI9341 panels and reports what each draw would have
+ *       cost on the SPI wire. Pass a directory as the first argument to also
+ *       save each panel's final contents as PPM images there, along with
+ *       capture.bin, both panels' screen capture stream. Exits with 1 if one
+ *       of the logic self-checks run at the end fails.
+ */
+
+#include <stdint.h>
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DashNode.h"
+#include "LogicChecks.h"
+#include "MenuNode.h"
+#include "NumericGauge.h"
+#include "ScreenCapture.h"
+#include "libs/font_Arial.h"
+#include "libs/font_subsets.h"
+#include "libs/sprites.h"
+
+// Matches the glyph cache budget main() gives the displays
+constexpr uint32_t kGlyphCacheSize = 8704;
+
+// Matches the dash's band buffers in main()
+constexpr uint32_t kBandPixels = ILI9341_TFTHEIGHT * 16;
+
+static void printHeader() {
+  std::printf("%-22s %5s %9s %8s %8s %8s %6s %8s %9s\n", "draw", "panel",
+              "bytes", "commands", "addrsets", "pixels", "trans", "longest",
+              "wire(us)");
+}
+
+static void printStats(const char* name, uint32_t panel,
+                       const ILI9341_EmuStats& stats, const char* note = "") {
+  std::printf("%-22s %5u %9u %8u %8u %8u %6u %8u %9u%s\n", name, panel,
+              stats.bytes, stats.commands, stats.addressSets, stats.pixels,
+              stats.transactions, stats.longest,
+              stats.wireMicros(ILI9341_SPICLOCK), note);
+}
+
+/* Draws the node the way the main loop does, latching it, then invalidating it
+ * first if it wasn't the node on screen
+ */
+static void measure(const char* name, Display* displays, Node* node) {
+  static Node* drawnNode = nullptr;
+
+  for (uint32_t i = 0; i < 2; i++) {
+    displays[i].emulator().resetStats();
+  }
+
+  node->latch();
+  if (node != drawnNode) {
+    for (uint32_t i = 0; i < 2; i++) {
+      displays[i].setScroll(0);
+    }
+    node->invalidate();
+    drawnNode = node;
+  }
+  node->draw(displays);
+
+  // Count any pixels still queued for DMA as part of this draw
+  Display::waitAsync();
+
+  for (uint32_t i = 0; i < 2; i++) {
+    printStats(name, i, displays[i].emulator().stats());
+  }
+}
+
+/* Shows a menu, then moves its selection down one row at a time until it
+ * scrolls, and reports that step
+ */
+static void measureScroll(const char* name, Display* displays, MenuNode* node,
+                          uint32_t rotation) {
+  measure(name, displays, node);
+
+  uint32_t rows = displays[0].height() / MenuNode::k_rowHeight;
+  if (rotation == 0) {
+    rows = MenuNode::k_scrollRows;
+  }
+  while (node->childIndex < rows - 1) {
+    node->childIndex++;
+    node->draw(displays);
+  }
+
+  std::string step = std::string(name) + " scroll";
+  node->childIndex++;
+  measure(step.c_str(), displays, node);
+}
+
+static uint32_t g_asyncCompletions = 0;
+
+static void onAsyncComplete() { g_asyncCompletions++; }
+
+/* Clears a panel with fillRectAsync(), advancing the emulated DMA one main
+ * loop's worth of pixels at a time, and reports how many loops it spanned
+ */
+static void measureAsyncClear(Display& display, uint32_t panel) {
+  constexpr uint32_t kPixelsPerLoop = 4096;
+
+  display.emulator().resetStats();
+  display.fillRectAsync(0, 0, display.width(), display.height(),
+                        ILI9341_BLACK, onAsyncComplete);
+
+  uint32_t loops = 0;
+  while (Display::asyncBusy()) {
+    display.emulator().serviceDma(kPixelsPerLoop);
+    loops++;
+  }
+
+  char note[40];
+  std::snprintf(note, sizeof(note), "  (%u loops, %u callbacks)", loops,
+                g_asyncCompletions);
+  printStats("clear (async)", panel, display.emulator().stats(), note);
+}
+
+/* Clears a panel with the given transaction bound, to show what it costs in
+ * transactions against the longest time the bus is held
+ */
+static void measureBoundedClear(const char* name, Display& display,
+                                uint32_t panel, uint32_t micros) {
+  uint32_t maxTransaction = display.getMaxTransaction();
+  if (micros > 0) {
+    display.setMaxTransactionMicros(micros);
+  } else {
+    display.setMaxTransaction(0);
+  }
+
+  display.emulator().resetStats();
+  display.fillScreen(ILI9341_BLACK);
+  printStats(name, panel, display.emulator().stats());
+
+  display.setMaxTransaction(maxTransaction);
+}
+
+/* Draws an analog gauge face, then moves its needle one step the way a
+ * 20 Hz tachometer would each frame: erase the old needle, draw the new one
+ * and repaint the hub over both
+ */
+static void measureNeedle(Display& display, uint32_t panel) {
+  constexpr int16_t kCenterX = 160;
+  constexpr int16_t kCenterY = 120;
+  constexpr int16_t kRadius = 100;
+  constexpr int16_t kNeedle = 90;
+  constexpr int16_t kHub = 8;
+
+  auto tip = [&](double degrees, int16_t& x, int16_t& y) {
+    x = kCenterX + std::lround(kNeedle * std::cos(degrees * M_PI / 180));
+    y = kCenterY - std::lround(kNeedle * std::sin(degrees * M_PI / 180));
+  };
+
+  int16_t oldX, oldY, newX, newY;
+  tip(150, oldX, oldY);
+  tip(147, newX, newY);
+
+  display.emulator().resetStats();
+  display.fillScreen(ILI9341_BLACK);
+  display.drawCircle(kCenterX, kCenterY, kRadius, ILI9341_WHITE);
+  display.drawCircle(kCenterX, kCenterY, kRadius - 1, ILI9341_WHITE);
+  display.drawLine(kCenterX, kCenterY, oldX, oldY, ILI9341_RED);
+  display.fillCircle(kCenterX, kCenterY, kHub, ILI9341_WHITE);
+  printStats("gauge face", panel, display.emulator().stats());
+
+  display.emulator().resetStats();
+  display.drawLine(kCenterX, kCenterY, oldX, oldY, ILI9341_BLACK);
+  display.drawLine(kCenterX, kCenterY, newX, newY, ILI9341_RED);
+  display.fillCircle(kCenterX, kCenterY, kHub, ILI9341_WHITE);
+  printStats("needle step", panel, display.emulator().stats());
+}
+
+/* Runs update 32 times, idling a varying time between them as the main loop
+ * would, and counts the updates some refresh showed torn. The stats printed
+ * are the last update's.
+ */
+template <typename Update>
+static void measureTearing(const char* name, Display& display, uint32_t panel,
+                           Update update) {
+  constexpr uint32_t kUpdates = 32;
+
+  uint32_t seed = 1;
+  uint32_t torn = 0;
+  uint32_t waited = 0;
+  for (uint32_t i = 0; i < kUpdates; i++) {
+    seed = seed * 1103515245 + 12345;
+    delayMicroseconds(seed >> 16 & 0x3FFF);
+
+    display.emulator().resetStats();
+    uint32_t start = host::g_micros;
+    update(i);
+    waited += host::g_micros - start;
+    if (display.emulator().stats().refreshes() > 1) {
+      torn++;
+    }
+  }
+
+  char note[48];
+  std::snprintf(note, sizeof(note), "  %u/%u torn, %u us waited", torn,
+                kUpdates, waited / kUpdates);
+  printStats(name, panel, display.emulator().stats(), note);
+}
+
+/* Steps the dash's speed readout, then fills the whole panel in portrait, each
+ * as drawn straight away and scheduled against the refresh
+ */
+static void measureScanout(Display& display, uint32_t panel) {
+  NumericGauge speed(0, 50, 2, Arial_96_Dash, ILI9341_YELLOW, ILI9341_BLACK);
+  display.fillScreen(ILI9341_BLACK);
+  auto stepSpeed = [&](uint32_t i) {
+    speed.setValue(38 + i);
+    speed.draw(display);
+  };
+  measureTearing("speed steps", display, panel, stepSpeed);
+  speed.setTearFree(true);
+  measureTearing("speed steps (synced)", display, panel, stepSpeed);
+
+  // A full portrait fill is slower than the beam at 79 Hz, which laps it
+  // before it's done, but not at 30
+  const uint16_t colors[2] = {ILI9341_NAVY, ILI9341_DARKGREEN};
+  display.setRotation(0);
+  measureTearing("portrait fill", display, panel, [&](uint32_t i) {
+    display.fillRect(0, 0, display.width(), display.height(), colors[i & 1]);
+  });
+  auto syncedFill = [&](uint32_t i) {
+    display.waitForScanout(0, 0, display.width(), display.height());
+    display.fillRect(0, 0, display.width(), display.height(), colors[i & 1]);
+  };
+  measureTearing("portrait fill (synced)", display, panel, syncedFill);
+  display.setFrameRate(30);
+  measureTearing("  at 30 Hz", display, panel, syncedFill);
+  display.setFrameRate(79);
+  display.setRotation(1);
+}
+
+/* Draws the logo's white pixels as a 1 bit bitmap, the way drawBitmap() would
+ * have to show it, then the whole logo and the warning icon as sprites
+ */
+static void measureSprites(Display& display, uint32_t panel) {
+  const ILI9341_t3_sprite_t& logo = Sprite_Logo;
+  constexpr uint16_t kWhite = 1;  // the logo's palette index for white
+
+  uint32_t bytesPerRow = (logo.width + 7) / 8;
+  std::vector<uint8_t> bitmap(bytesPerRow * logo.height);
+  const uint8_t* p = logo.data;
+  for (uint32_t i = 0; i < logo.width * logo.height;) {
+    uint32_t index = *p & 0x0F;
+    uint32_t count = (*p++ >> 4) + 1;
+    if (count == 16) {
+      count += *p++;
+    }
+    for (; count > 0; count--, i++) {
+      if (index == kWhite) {
+        uint32_t x = i % logo.width;
+        bitmap[i / logo.width * bytesPerRow + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+
+  display.fillScreen(ILI9341_BLACK);
+  display.emulator().resetStats();
+  display.drawBitmap(10, 10, bitmap.data(), logo.width, logo.height,
+                     ILI9341_WHITE);
+  printStats("logo (drawBitmap)", panel, display.emulator().stats());
+
+  display.emulator().resetStats();
+  display.drawSprite(10, 10, logo);
+  printStats("logo (sprite)", panel, display.emulator().stats());
+
+  display.emulator().resetStats();
+  display.drawSprite(100, 10, Sprite_Warning);
+  printStats("warning (sprite)", panel, display.emulator().stats());
+}
+
+/* A node drawn only through record(): a battery bar with its charge printed
+ * beside it, a needle, and an icon that turns red when the charge runs low.
+ * Changing the charge repaints just what moved.
+ */
+class BatteryNode : public Node {
+ public:
+  BatteryNode() : Node("Battery") {
+    for (uint32_t i = 0; i < kIconSize * kIconSize; i++) {
+      m_icons[0][i] = ILI9341_GREEN;
+      m_icons[1][i] = ILI9341_RED;
+    }
+  }
+
+  uint32_t charge = 87;
+
+ protected:
+  bool record(Display& display, uint32_t i,
+              ILI9341_t3_BandRenderer& renderer) override {
+    if (i != 0) {
+      return renderer.drawText("Battery", 10, 10, Arial_20, ILI9341_WHITE);
+    }
+
+    bool recorded = renderer.fillRect(10, 40, 2 * charge, 30, ILI9341_GREEN);
+    recorded &= renderer.fillRect(10 + 2 * charge, 40, 2 * (100 - charge), 30,
+                                  ILI9341_DARKGREY);
+
+    char text[8];
+    std::snprintf(text, sizeof(text), "%u%%", charge);
+    recorded &= renderer.drawText(text, 230, 44, Arial_20, ILI9341_WHITE);
+
+    double angle = M_PI * charge / 100;
+    recorded &= renderer.drawLine(160, 200,
+                                  160 - std::lround(80 * std::cos(angle)),
+                                  200 - std::lround(80 * std::sin(angle)),
+                                  ILI9341_RED);
+    recorded &= renderer.writeRect(290, 10, kIconSize, kIconSize,
+                                   m_icons[charge < 20 ? 1 : 0]);
+    return recorded;
+  }
+
+ private:
+  static constexpr uint32_t kIconSize = 16;
+
+  uint16_t m_icons[2][kIconSize * kIconSize];
+};
+
+// Collects what a ScreenCapture writes, standing in for Serial
+class CaptureSink : public Print {
+ public:
+  size_t write(uint8_t b) override {
+    data += static_cast<char>(b);
+    return 1;
+  }
+
+  std::string data;
+};
+
+/* Streams a panel's contents through a ScreenCapture the way the main loop
+ * does, with a USB packet's worth of budget and main()'s readback time per
+ * call, and reports the readback it cost and how small the frame got
+ */
+static void measureCapture(Display& display, uint32_t panel,
+                           CaptureSink& sink) {
+  constexpr uint32_t kBudget = 64;
+  constexpr uint32_t kReadMicros = 250;
+
+  static ScreenCapture capture;
+  size_t begin = sink.data.size();
+
+  display.emulator().resetStats();
+  capture.start(display, panel);
+  uint32_t calls = 0;
+  while (capture.busy()) {
+    capture.service(sink, kBudget, kReadMicros);
+    calls++;
+  }
+
+  uint32_t size = sink.data.size() - begin;
+  uint32_t raw = 2 * display.width() * display.height();
+  char note[48];
+  std::snprintf(note, sizeof(note), "  (%u -> %u bytes, %u calls)", raw, size,
+                calls);
+  printStats("capture", panel, display.emulator().stats(), note);
+}
+
+int main(int argc, char* argv[]) {
+  Display tft[2] = {Display(10, 15, 255, 11, 14), Display(9, 20, 255, 11, 14)};
+
+  static uint8_t glyphCacheBuf[kGlyphCacheSize];
+  ILI9341_t3_GlyphCache glyphCache(glyphCacheBuf, sizeof(glyphCacheBuf));
+
+  printHeader();
+
+  // Startup as main() does it, broadcasting to both panels
+  uint32_t startMillis = millis();
+  tft[0].begin(tft[1]);
+  tft[0].setBroadcast(&tft[1]);
+  tft[0].setRotation(1);
+  tft[0].fillScreen(ILI9341_BLACK);
+  tft[0].displayOn();
+  tft[0].setBroadcast(nullptr);
+
+  for (uint32_t i = 0; i < 2; i++) {
+    tft[i].setTextColor(ILI9341_YELLOW);
+    tft[i].setFont(Arial_20);
+    tft[i].setCursor(0, 4);
+    tft[i].setGlyphCache(&glyphCache);
+
+    char note[32] = "";
+    if (i == 0) {
+      std::snprintf(note, sizeof(note), "  %u ms to display on",
+                    millis() - startMillis);
+    }
+    printStats("startup", i, tft[i].emulator().stats(), note);
+  }
+
+  measureAsyncClear(tft[0], 0);
+  measureBoundedClear("clear (unbounded)", tft[0], 0, 0);
+  measureBoundedClear("clear (50 us bound)", tft[0], 0, 50);
+  measureNeedle(tft[0], 0);
+  measureSprites(tft[0], 0);
+  measureScanout(tft[0], 0);
+
+  // Same tree shape as the firmware builds in main()
+  auto head = std::make_unique<DashNode>();
+  head->m_nodeType = NodeType::DashHead;
+
+  auto menuHead = std::make_unique<MenuNode>();
+  menuHead->m_nodeType = NodeType::MenuHead;
+  Node* menu = menuHead.get();
+
+  auto sensors = std::make_unique<MenuNode>("Sensors");
+  sensors->addChild(std::make_unique<Node>("Sensor 1"));
+  sensors->addChild(std::make_unique<Node>("Sensor 2"));
+  sensors->addChild(std::make_unique<Node>("Sensor 3"));
+  menuHead->addChild(std::move(sensors));
+  menuHead->addChild(std::make_unique<MenuNode>("Settings"));
+  menuHead->addChild(std::make_unique<MenuNode>("Other"));
+  head->addChild(std::move(menuHead));
+
+  measure("dash", tft, head.get());
+  measure("dash (repeat)", tft, head.get());
+
+  static uint16_t bandBuf[2][kBandPixels];
+  ILI9341_t3_BandRenderer bandRenderer(bandBuf[0], bandBuf[1], kBandPixels);
+  static DisplayList displayLists[Node::k_numDisplays];
+  head->setRenderer(&bandRenderer, displayLists);
+  head->invalidate();
+  measure("dash (retained)", tft, head.get());
+  head->setSpeed(42);
+  measure("dash speed 42", tft, head.get());
+  head->setSpeed(43);
+  measure("dash speed 43", tft, head.get());
+
+  BatteryNode battery;
+  battery.setRenderer(&bandRenderer, displayLists);
+  measure("battery", tft, &battery);
+  battery.charge = 86;
+  measure("battery 86%", tft, &battery);
+  battery.charge = 19;
+  measure("battery 19%", tft, &battery);
+
+  measure("menu", tft, menu);
+  menu->childIndex++;
+  measure("menu down", tft, menu);
+  menu->childIndex--;
+  measure("menu up", tft, menu);
+
+  // A menu longer than the screen, stepped past the bottom edge
+  auto longMenu = std::make_unique<MenuNode>("Long");
+  for (uint32_t i = 0; i < 10; i++) {
+    char name[Node::k_maxNodeNameChars + 1];
+    std::snprintf(name, sizeof(name), "Item %u", i);
+    longMenu->addChild(std::make_unique<Node>(name));
+  }
+  measureScroll("long menu", tft, longMenu.get(), 1);
+
+  // Portrait puts the hardware scrolling along y, so only the new row is drawn
+  auto portraitMenu = std::make_unique<MenuNode>("Portrait");
+  for (uint32_t i = 0; i < 10; i++) {
+    char name[Node::k_maxNodeNameChars + 1];
+    std::snprintf(name, sizeof(name), "Item %u", i);
+    portraitMenu->addChild(std::make_unique<Node>(name));
+  }
+  tft[0].setRotation(0);
+  measureScroll("portrait menu", tft, portraitMenu.get(), 0);
+  if (argc > 1) {
+    std::string path = std::string(argv[1]) + "/portrait.ppm";
+    tft[0].emulator().savePPM(path.c_str());
+  }
+  tft[0].setRotation(1);
+  measure("menu", tft, menu);
+
+  CaptureSink captureSink;
+  for (uint32_t i = 0; i < 2; i++) {
+    measureCapture(tft[i], i, captureSink);
+  }
+
+  std::printf(
+      "\nglyph cache: %u hits, %u misses, %u evictions, %u of %u bytes used\n",
+      glyphCache.hits(), glyphCache.misses(), glyphCache.evictions(),
+      glyphCache.bytesUsed(), kGlyphCacheSize);
+
+  std::printf("\n");
+  bool checked = checkEventQueue();
+  checked &= checkVerticalDebouncer();
+  checked &= checkTimerWheel();
+  checked &= checkText();
+  checked &= checkDisplayList();
+  checked &= checkAntiAliasedText();
+  checked &= checkSparseFont();
+
+  if (argc > 1) {
+    std::string capturePath = std::string(argv[1]) + "/capture.bin";
+    FILE* captureFile = std::fopen(capturePath.c_str(), "wb");
+    if (captureFile == nullptr ||
+        std::fwrite(captureSink.data.data(), 1, captureSink.data.size(),
+                    captureFile) != captureSink.data.size()) {
+      std::fprintf(stderr, "failed to write %s\n", capturePath.c_str());
+      return 1;
+    }
+    std::fclose(captureFile);
+
+    for (uint32_t i = 0; i < 2; i++) {
+      std::string path =
+          std::string(argv[1]) + "/panel" + std::to_string(i) + ".ppm";
+      if (!tft[i].emulator().savePPM(path.c_str())) {
+        std::fprintf(stderr, "failed to write %s\n", path.c_str());
+        return 1;
+      }
+    }
+  }
+
+  return checked ? 0 : 1;
+}
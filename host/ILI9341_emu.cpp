@@ -0,0 +1,301 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "ILI9341_emu.h"
+
+#include <cstdio>
+
+#include "ILI9341_t3.h"
+
+#define MADCTL_MY 0x80
+#define MADCTL_MX 0x40
+#define MADCTL_MV 0x20
+
+namespace host {
+uint32_t g_micros = 0;
+}  // namespace host
+
+// Bytes moved over the SPI bus the panels share
+static uint64_t s_busBytes = 0;
+
+uint64_t host::nanos() { return ILI9341_Emulator::nanos(); }
+
+ILI9341_Emulator::ILI9341_Emulator()
+    : m_linePeriod(24 * 1000000000ULL / ILI9341_FOSC) {
+  for (auto& px : m_gram) {
+    px = ILI9341_BLACK;
+  }
+}
+
+void ILI9341_Emulator::endTransaction() {
+  uint32_t bytes = m_stats.bytes - m_transactionStart;
+  if (bytes > m_stats.longest) {
+    m_stats.longest = bytes;
+  }
+}
+
+uint64_t ILI9341_Emulator::nanos() {
+  return host::g_micros * 1000ULL + s_busBytes * 8000000000 / ILI9341_SPICLOCK;
+}
+
+void ILI9341_Emulator::writeCommand(uint8_t c) {
+  m_stats.bytes++;
+  s_busBytes++;
+  m_stats.commands++;
+  if (c == ILI9341_CASET || c == ILI9341_PASET) {
+    m_stats.addressSets++;
+  }
+
+  receiveCommand(c);
+  if (m_mirror != nullptr) {
+    m_mirror->receiveCommand(c);
+  }
+}
+
+void ILI9341_Emulator::writeData8(uint8_t d) {
+  m_stats.bytes++;
+  s_busBytes++;
+
+  receiveData8(d);
+  if (m_mirror != nullptr) {
+    m_mirror->receiveData8(d);
+  }
+}
+
+void ILI9341_Emulator::writeData16(uint16_t d) {
+  m_stats.bytes += 2;
+  s_busBytes += 2;
+
+  receiveData16(d);
+  if (m_mirror != nullptr) {
+    m_mirror->receiveData16(d);
+  }
+}
+
+uint8_t ILI9341_Emulator::readRegister(uint8_t reg, uint8_t index) {
+  m_stats.bytes++;
+  s_busBytes++;
+
+  uint32_t line = nanos() / m_linePeriod % ILI9341_SCANLINES;
+  switch (reg) {
+    case ILI9341_RDMADCTL:
+      return m_madctl;
+    case ILI9341_GSCAN:
+      return index == 0 ? line >> 8 : line & 0xFF;
+    default:
+      return 0;
+  }
+}
+
+void ILI9341_Emulator::readRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                                uint16_t* pcolors) {
+  // One dummy byte, then three bytes (R, G, B) per pixel
+  m_stats.bytes += 1 + 3 * w * h;
+  s_busBytes += 1 + 3 * w * h;
+
+  for (int32_t row = y; row < y + h; row++) {
+    for (int32_t col = x; col < x + w; col++) {
+      *pcolors++ = pixel(col, row);
+    }
+  }
+}
+
+void ILI9341_Emulator::startDma(const uint16_t* source, uint16_t color,
+                                uint32_t count) {
+  m_dmaSource = source;
+  m_dmaColor = color;
+  m_dmaRemaining = count;
+}
+
+uint32_t ILI9341_Emulator::serviceDma(uint32_t maxPixels) {
+  uint32_t count = 0;
+  while (m_dmaRemaining > 0 && count < maxPixels) {
+    writeData16(m_dmaSource != nullptr ? *m_dmaSource++ : m_dmaColor);
+    m_dmaRemaining--;
+    count++;
+  }
+
+  if (count > 0 && m_dmaRemaining == 0 && m_dmaISR != nullptr) {
+    m_dmaISR();
+  }
+  return count;
+}
+
+uint16_t ILI9341_Emulator::pixel(int32_t x, int32_t y) const {
+  uint32_t i = gramIndex(x, y);
+  if (i >= k_gramWidth * k_gramHeight) {
+    return ILI9341_BLACK;
+  }
+  return m_gram[i];
+}
+
+uint16_t ILI9341_Emulator::shownPixel(int32_t x, int32_t y) const {
+  uint32_t i = gramIndex(x, y);
+  if (i >= k_gramWidth * k_gramHeight) {
+    return ILI9341_BLACK;
+  }
+
+  // Lines inside the scrolling area are scanned out starting from the line
+  // VSCRSADD selects, wrapping around within the area
+  int32_t row = i / k_gramWidth;
+  int32_t top = m_scrollTop;
+  int32_t height = m_scrollHeight;
+  if (row >= top && row < top + height && m_scrollStart >= top &&
+      m_scrollStart < top + height) {
+    row = top + (row - top + m_scrollStart - top) % height;
+  }
+  return m_gram[row * k_gramWidth + i % k_gramWidth];
+}
+
+bool ILI9341_Emulator::savePPM(const char* path) const {
+  std::FILE* file = std::fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  int32_t width = k_gramWidth;
+  int32_t height = k_gramHeight;
+  if (m_madctl & MADCTL_MV) {
+    width = k_gramHeight;
+    height = k_gramWidth;
+  }
+
+  std::fprintf(file, "P6\n%d %d\n255\n", width, height);
+  for (int32_t y = 0; y < height; y++) {
+    for (int32_t x = 0; x < width; x++) {
+      uint16_t color = shownPixel(x, y);
+      uint8_t rgb[3] = {static_cast<uint8_t>((color >> 8) & 0xF8),
+                        static_cast<uint8_t>((color >> 3) & 0xFC),
+                        static_cast<uint8_t>((color << 3) & 0xF8)};
+      std::fwrite(rgb, 1, sizeof(rgb), file);
+    }
+  }
+
+  std::fclose(file);
+  return true;
+}
+
+void ILI9341_Emulator::receiveCommand(uint8_t c) {
+  m_command = c;
+  m_paramCount = 0;
+  m_pixelHalf = false;
+
+  if (c == ILI9341_RAMWR) {
+    m_x = m_xStart;
+    m_y = m_yStart;
+  }
+}
+
+void ILI9341_Emulator::receiveData8(uint8_t d) {
+  if (m_command == ILI9341_RAMWR) {
+    if (m_pixelHalf) {
+      storePixel((m_pixelHigh << 8) | d);
+    } else {
+      m_pixelHigh = d;
+    }
+    m_pixelHalf = !m_pixelHalf;
+    return;
+  }
+
+  if (m_paramCount < sizeof(m_params)) {
+    m_params[m_paramCount] = d;
+  }
+  m_paramCount++;
+
+  switch (m_command) {
+    case ILI9341_CASET:
+      if (m_paramCount == 4) {
+        m_xStart = (m_params[0] << 8) | m_params[1];
+        m_xEnd = (m_params[2] << 8) | m_params[3];
+      }
+      break;
+    case ILI9341_PASET:
+      if (m_paramCount == 4) {
+        m_yStart = (m_params[0] << 8) | m_params[1];
+        m_yEnd = (m_params[2] << 8) | m_params[3];
+      }
+      break;
+    case ILI9341_MADCTL:
+      m_madctl = d;
+      break;
+    case ILI9341_FRMCTR1:
+      if (m_paramCount == 2) {
+        // RTNA below 16 clocks isn't allowed and reads as 16
+        uint32_t rtna = m_params[1] & 0x1F;
+        uint64_t clocks = (rtna < 16 ? 16 : rtna) << (m_params[0] & 0x03);
+        m_linePeriod = clocks * 1000000000 / ILI9341_FOSC;
+      }
+      break;
+    case ILI9341_VSCRDEF:
+      if (m_paramCount == 6) {
+        m_scrollTop = (m_params[0] << 8) | m_params[1];
+        m_scrollHeight = (m_params[2] << 8) | m_params[3];
+      }
+      break;
+    case ILI9341_VSCRSADD:
+      if (m_paramCount == 2) {
+        m_scrollStart = (m_params[0] << 8) | m_params[1];
+      }
+      break;
+  }
+}
+
+void ILI9341_Emulator::receiveData16(uint16_t d) {
+  if (m_command == ILI9341_RAMWR && !m_pixelHalf) {
+    storePixel(d);
+  } else {
+    receiveData8(d >> 8);
+    receiveData8(d & 0xFF);
+  }
+}
+
+uint32_t ILI9341_Emulator::gramIndex(int32_t x, int32_t y) const {
+  int32_t col = x;
+  int32_t row = y;
+  if (m_madctl & MADCTL_MV) {
+    col = y;
+    row = x;
+  }
+  if (col < 0 || col >= k_gramWidth || row < 0 || row >= k_gramHeight) {
+    return k_gramWidth * k_gramHeight;
+  }
+  if (m_madctl & MADCTL_MX) {
+    col = k_gramWidth - 1 - col;
+  }
+  if (m_madctl & MADCTL_MY) {
+    row = k_gramHeight - 1 - row;
+  }
+  return row * k_gramWidth + col;
+}
+
+void ILI9341_Emulator::storePixel(uint16_t color) {
+  m_stats.pixels++;
+
+  uint32_t i = gramIndex(m_x, m_y);
+  if (i < k_gramWidth * k_gramHeight) {
+    m_gram[i] = color;
+
+    // The beam reaches this line in each refresh at line * m_linePeriod past
+    // its start, so the first refresh to show the pixel is the next one to
+    int64_t frame = static_cast<int64_t>(m_linePeriod) * ILI9341_SCANLINES;
+    int64_t since = static_cast<int64_t>(nanos()) -
+                    static_cast<int64_t>(i / k_gramWidth) * m_linePeriod;
+    uint32_t refresh = since <= 0 ? 0 : (since + frame - 1) / frame;
+    if (refresh < m_stats.firstRefresh) {
+      m_stats.firstRefresh = refresh;
+    }
+    if (refresh > m_stats.lastRefresh) {
+      m_stats.lastRefresh = refresh;
+    }
+  }
+
+  if (m_x < m_xEnd) {
+    m_x++;
+  } else {
+    m_x = m_xStart;
+    if (m_y < m_yEnd) {
+      m_y++;
+    } else {
+      m_y = m_yStart;
+    }
+  }
+}
@@ -0,0 +1,136 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+/* Counters for everything that would have crossed the SPI wire. Reset them
+ * before a draw call and read them back afterward to get that call's cost.
+ */
+struct ILI9341_EmuStats {
+  uint32_t bytes = 0;         // command and data bytes clocked out
+  uint32_t commands = 0;      // bytes sent with DC low
+  uint32_t addressSets = 0;   // CASET and PASET commands
+  uint32_t pixels = 0;        // RGB565 pixels written to GRAM
+  uint32_t transactions = 0;  // SPI.beginTransaction() calls
+  uint32_t longest = 0;       // most bytes sent in a single transaction
+
+  // Range of refreshes, counted from power on, that first showed the pixels
+  // written. An update spread over more than one was seen torn.
+  uint32_t firstRefresh = UINT32_MAX;
+  uint32_t lastRefresh = 0;
+  uint32_t refreshes() const {
+    return pixels > 0 ? lastRefresh - firstRefresh + 1 : 0;
+  }
+
+  // Time the bytes would take on the wire at the given SPI clock, in us
+  uint32_t wireMicros(uint32_t clock) const {
+    return static_cast<uint64_t>(bytes) * 8 * 1000000 / clock;
+  }
+};
+
+/* Models the ILI9341 controller at the command level. Bytes fed to it are
+ * decoded exactly as the panel would: CASET/PASET latch the address window,
+ * RAMWR streams RGB565 pixels into GRAM, and MADCTL selects how the window
+ * maps onto the physical 240x320 memory.
+ *
+ * Time runs on host::g_micros plus the bytes every emulated panel has moved
+ * over the shared bus at ILI9341_SPICLOCK. The refresh beam sweeps GRAM a
+ * line at a time at the rate FRMCTR1 sets, and GSCAN reads back its line.
+ */
+class ILI9341_Emulator {
+ public:
+  static constexpr int32_t k_gramWidth = 240;
+  static constexpr int32_t k_gramHeight = 320;
+
+  ILI9341_Emulator();
+
+  void beginTransaction() {
+    m_stats.transactions++;
+    m_transactionStart = m_stats.bytes;
+  }
+  void endTransaction();
+
+  void writeCommand(uint8_t c);
+  void writeData8(uint8_t d);
+  void writeData16(uint16_t d);
+
+  // Returns the parameter byte a register read would clock back
+  uint8_t readRegister(uint8_t reg, uint8_t index);
+
+  // Emulated time, in ns
+  static uint64_t nanos();
+
+  // Reads back GRAM through the current MADCTL mapping, like RAMRD does
+  void readRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* pcolors);
+
+  // Pixel at (x, y) in the coordinate space selected by the current MADCTL
+  uint16_t pixel(int32_t x, int32_t y) const;
+
+  // Pixel the panel shows at (x, y), after vertical scrolling
+  uint16_t shownPixel(int32_t x, int32_t y) const;
+
+  /* DMA model: startDma() queues count pixels, read from source or repeating
+   * color when source is null, behind a RAMWR the caller already sent. They
+   * reach GRAM only as serviceDma() is called, and the completion interrupt
+   * runs once the last one has been written.
+   */
+  void attachDmaInterrupt(void (*isr)(void)) { m_dmaISR = isr; }
+  void startDma(const uint16_t* source, uint16_t color, uint32_t count);
+  bool dmaBusy() const { return m_dmaRemaining > 0; }
+
+  // Moves up to maxPixels queued pixels and returns how many were moved
+  uint32_t serviceDma(uint32_t maxPixels);
+
+  /* Models a second panel whose chip select is asserted alongside this one's.
+   * It decodes every byte written here, but the bytes are only counted once,
+   * in this panel's stats. Pass nullptr to detach it.
+   */
+  void setMirror(ILI9341_Emulator* mirror) { m_mirror = mirror; }
+
+  const ILI9341_EmuStats& stats() const { return m_stats; }
+  void resetStats() { m_stats = ILI9341_EmuStats(); }
+
+  // Writes what the panel shows, through the current rotation and scrolling,
+  // to a binary PPM file
+  bool savePPM(const char* path) const;
+
+ private:
+  // Decode what the panel receives, without counting it on the wire
+  void receiveCommand(uint8_t c);
+  void receiveData8(uint8_t d);
+  void receiveData16(uint16_t d);
+
+  uint32_t gramIndex(int32_t x, int32_t y) const;
+  void storePixel(uint16_t color);
+
+  uint16_t m_gram[k_gramWidth * k_gramHeight];
+
+  uint8_t m_command = 0;
+  uint8_t m_params[16];
+  uint32_t m_paramCount = 0;
+  bool m_pixelHalf = false;
+  uint8_t m_pixelHigh = 0;
+
+  uint8_t m_madctl = 0;
+  uint16_t m_scrollTop = 0;
+  uint16_t m_scrollHeight = k_gramHeight;
+  uint16_t m_scrollStart = 0;
+  uint16_t m_xStart = 0;
+  uint16_t m_xEnd = k_gramWidth - 1;
+  uint16_t m_yStart = 0;
+  uint16_t m_yEnd = k_gramHeight - 1;
+  uint16_t m_x = 0;
+  uint16_t m_y = 0;
+  uint32_t m_linePeriod;  // ns
+
+  void (*m_dmaISR)(void) = nullptr;
+  const uint16_t* m_dmaSource = nullptr;
+  uint16_t m_dmaColor = 0;
+  uint32_t m_dmaRemaining = 0;
+
+  ILI9341_Emulator* m_mirror = nullptr;
+
+  ILI9341_EmuStats m_stats;
+  uint32_t m_transactionStart = 0;
+};
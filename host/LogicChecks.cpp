@@ -0,0 +1,664 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "LogicChecks.h"
+
+#include <stdint.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "DisplayList.h"
+#include "EventQueue.h"
+#include "Node.h"
+#include "TimerWheel.h"
+#include "VerticalDebouncer.h"
+#include "libs/ILI9341_t3.h"
+#include "libs/font_Arial.h"
+
+// Failures seen by the check running now
+static uint32_t g_failures;
+
+static void expect(bool condition, const char* what) {
+  if (!condition) {
+    std::printf("  failed: %s\n", what);
+    g_failures++;
+  }
+}
+
+static bool report(const char* name) {
+  std::printf("%s: %s\n", name, g_failures == 0 ? "ok" : "FAILED");
+  bool passed = g_failures == 0;
+  g_failures = 0;
+  return passed;
+}
+
+bool checkEventQueue() {
+  constexpr uint32_t kSize = 8;
+  EventQueue<uint32_t, kSize> queue;
+  uint32_t event;
+
+  expect(!queue.pop(event), "an empty queue pops nothing");
+
+  /* Uneven batches of pushes and pops, never overfilling it, drift around the
+   * ring so every slot is reused in turn
+   */
+  uint32_t next = 0;
+  uint32_t expected = 0;
+  bool ordered = true;
+  for (uint32_t round = 0; round < 5 * kSize; round++) {
+    for (uint32_t i = 0; i < round % 5 + 1 && next - expected < kSize; i++) {
+      ordered &= queue.push(next++);
+    }
+    for (uint32_t i = 0; i < round % 3 + 1 && queue.pop(event); i++) {
+      ordered &= event == expected++;
+    }
+  }
+  while (queue.pop(event)) {
+    ordered &= event == expected++;
+  }
+  expect(ordered && expected == next && queue.dropped() == 0,
+         "events come out in the order they went in");
+
+  // A full queue drops new events and keeps the ones it has
+  EventQueue<uint32_t, kSize> full;
+  for (uint32_t i = 0; i < kSize; i++) {
+    expect(full.push(i), "all N slots are usable");
+  }
+  expect(!full.push(kSize), "a full queue refuses a push");
+  expect(full.dropped() == 1, "a refused push is counted as dropped");
+  ordered = true;
+  for (uint32_t i = 0; i < kSize; i++) {
+    ordered &= full.pop(event) && event == i;
+  }
+  expect(ordered, "a full queue keeps its oldest events");
+  expect(!full.pop(event), "a drained queue pops nothing");
+  expect(full.push(kSize + 1) && full.pop(event) && event == kSize + 1,
+         "a drained queue takes events again");
+
+  return report("event queue");
+}
+
+bool checkVerticalDebouncer() {
+  constexpr uint32_t kHoldSamples = 10;
+  constexpr uint32_t kA = 1u << 0;
+  constexpr uint32_t kB = 1u << 31;
+  VerticalDebouncer debouncer(kHoldSamples);
+
+  // A change takes four samples in a row to flip the state
+  for (uint32_t i = 0; i < 3; i++) {
+    debouncer.update(kA);
+  }
+  expect(debouncer.state() == 0 && debouncer.pressed() == 0,
+         "three samples don't flip an input");
+  debouncer.update(kA);
+  expect(debouncer.state() == kA && debouncer.pressed() == kA,
+         "the fourth sample flips an input and reports it pressed");
+  debouncer.update(kA);
+  expect(debouncer.pressed() == 0, "a press is reported once");
+
+  // A sample that agrees with the state starts the count over
+  for (uint32_t i = 0; i < 3; i++) {
+    debouncer.update(kB);
+  }
+  debouncer.update(kA);
+  for (uint32_t i = 0; i < 3; i++) {
+    debouncer.update(kB);
+  }
+  expect(debouncer.state() == kA, "a bounce restarts the count");
+  debouncer.update(kB);
+  expect(debouncer.state() == kB && debouncer.pressed() == kB &&
+             debouncer.released() == kA,
+         "inputs flip independently of each other");
+
+  // Holding an input reports it held once, kHoldSamples samples after the
+  // sample that pressed it
+  VerticalDebouncer holder(kHoldSamples);
+  for (uint32_t press = 0; press < 2; press++) {
+    uint32_t helds = 0;
+    uint32_t heldAt = 0;
+    for (uint32_t i = 1; i <= 3 + 5 * kHoldSamples; i++) {
+      holder.update(kA);
+      if (holder.held() == kA) {
+        helds++;
+        heldAt = i;
+      }
+    }
+    expect(helds == 1 && heldAt == 3 + kHoldSamples,
+           "a held input is reported held once per press");
+
+    // A release, then a press too short to count as held
+    for (uint32_t i = 0; i < 4; i++) {
+      holder.update(0);
+    }
+    expect(holder.state() == 0, "four samples release an input");
+    for (uint32_t i = 0; i < kHoldSamples; i++) {
+      holder.update(i < 4 + kHoldSamples / 2 ? kA : 0);
+      expect(holder.held() == 0, "a short press isn't reported held");
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      holder.update(0);
+    }
+  }
+
+  return report("vertical debouncer");
+}
+
+/* The timer wheel check's timers. Each one's callback logs the tick it ran
+ * on, then runs its action, if it has one.
+ */
+constexpr uint32_t kCheckTimers = 8;
+
+struct TimerLog {
+  uint32_t fires;
+  uint32_t lastTick;
+};
+
+static TimerWheel* g_wheel;
+static uint32_t g_tick;
+static Timer g_checkTimers[kCheckTimers];
+static TimerLog g_timerLogs[kCheckTimers];
+static void (*g_timerActions[kCheckTimers])();
+
+template <uint32_t N>
+static void logTimer() {
+  g_timerLogs[N].fires++;
+  g_timerLogs[N].lastTick = g_tick;
+  if (g_timerActions[N] != nullptr) {
+    g_timerActions[N]();
+  }
+}
+
+// Starts over with a fresh wheel at tick 0 and timers that have never run
+static void resetTimers(TimerWheel& wheel) {
+  static void (*const callbacks[kCheckTimers])() = {
+      logTimer<0>, logTimer<1>, logTimer<2>, logTimer<3>,
+      logTimer<4>, logTimer<5>, logTimer<6>, logTimer<7>};
+
+  g_wheel = &wheel;
+  g_tick = 0;
+  for (uint32_t i = 0; i < kCheckTimers; i++) {
+    g_checkTimers[i] = Timer(callbacks[i]);
+    g_timerLogs[i] = {0, 0};
+    g_timerActions[i] = nullptr;
+  }
+}
+
+static void tickTimers(uint32_t ticks) {
+  for (uint32_t i = 0; i < ticks; i++) {
+    g_tick++;
+    g_wheel->tick();
+  }
+}
+
+static bool ranOnceAt(uint32_t i, uint32_t tick) {
+  return g_timerLogs[i].fires == 1 && g_timerLogs[i].lastTick == tick;
+}
+
+bool checkTimerWheel() {
+  Timer* timers = g_checkTimers;
+
+  /* Delays on either side of each level's span, armed at ticks that put the
+   * expiry across slot and level boundaries, run on exactly the tick due
+   */
+  const uint32_t delays[] = {1,    63,   64,     65,
+                             4095, 4096, 4097,   100000,
+                             TimerWheel::k_maxDelay};
+  const uint32_t starts[] = {0, 37, 4095};
+  bool onTime = true;
+  for (uint32_t start : starts) {
+    for (uint32_t delay : delays) {
+      TimerWheel wheel;
+      resetTimers(wheel);
+      tickTimers(start);
+      wheel.arm(timers[0], delay);
+      tickTimers(delay + 64);
+      onTime &= ranOnceAt(0, start + delay);
+    }
+  }
+  expect(onTime, "timers cascading down the levels run on time");
+
+  {
+    TimerWheel wheel;
+    resetTimers(wheel);
+
+    // Periodic timers run every period from their first expiry, including
+    // ones whose period needs a coarser level
+    wheel.arm(timers[0], 3, 7);
+    wheel.arm(timers[1], 5000, 5000);
+    tickTimers(20000);
+    expect(g_timerLogs[0].fires == 2857 && g_timerLogs[0].lastTick == 19995,
+           "a periodic timer runs every period");
+    expect(g_timerLogs[1].fires == 4 && g_timerLogs[1].lastTick == 20000,
+           "a long periodic timer runs every period");
+
+    // Arming an armed timer moves it, here to a single run
+    wheel.arm(timers[0], 50);
+    g_timerLogs[0] = {0, 0};
+    tickTimers(200);
+    expect(ranOnceAt(0, 20050), "re-arming a timer replaces its schedule");
+
+    // Periods are clamped like delays, so a long one can't wrap the wheel
+    wheel.arm(timers[2], 1, TimerWheel::k_maxDelay + 1000);
+    tickTimers(TimerWheel::k_maxDelay + 1);
+    expect(g_timerLogs[2].fires == 2 &&
+               g_timerLogs[2].lastTick == 20201 + TimerWheel::k_maxDelay,
+           "a period longer than k_maxDelay runs every k_maxDelay");
+  }
+
+  {
+    TimerWheel wheel;
+    resetTimers(wheel);
+
+    // Timer 0 cancels one timer due on the same tick and one due later
+    g_timerActions[0] = [] {
+      g_wheel->cancel(g_checkTimers[1]);
+      g_wheel->cancel(g_checkTimers[3]);
+    };
+    for (uint32_t i = 0; i < 3; i++) {
+      wheel.arm(timers[i], 10);
+    }
+    wheel.arm(timers[3], 20);
+
+    // Timer 4 stops itself after two runs, timer 5 re-arms itself for three
+    g_timerActions[4] = [] {
+      if (g_timerLogs[4].fires == 2) {
+        g_wheel->cancel(g_checkTimers[4]);
+      }
+    };
+    wheel.arm(timers[4], 5, 5);
+    g_timerActions[5] = [] {
+      if (g_timerLogs[5].fires < 3) {
+        g_wheel->arm(g_checkTimers[5], 4);
+      }
+    };
+    wheel.arm(timers[5], 4);
+
+    tickTimers(100);
+    expect(ranOnceAt(0, 10) && ranOnceAt(2, 10),
+           "timers due together all run");
+    expect(g_timerLogs[1].fires == 0 && g_timerLogs[3].fires == 0,
+           "a callback can cancel timers, including ones due on its tick");
+    expect(g_timerLogs[4].fires == 2 && !timers[4].armed(),
+           "a periodic timer can cancel itself");
+    expect(g_timerLogs[5].fires == 3 && g_timerLogs[5].lastTick == 12,
+           "a timer can re-arm itself");
+  }
+
+  {
+    /* Random arming, re-arming and canceling against a reference that
+     * tracks when each timer is next due
+     */
+    TimerWheel wheel;
+    resetTimers(wheel);
+    uint32_t due[kCheckTimers] = {};
+    uint32_t periods[kCheckTimers] = {};
+    uint32_t seed = 1;
+    auto random = [&seed](uint32_t range) {
+      seed = seed * 1103515245 + 12345;
+      return (seed >> 8) % range;
+    };
+
+    bool matched = true;
+    for (uint32_t tick = 0; tick < 300000; tick++) {
+      if (random(16) == 0) {
+        uint32_t i = random(kCheckTimers);
+        if (random(4) == 0) {
+          wheel.cancel(timers[i]);
+          due[i] = 0;
+        } else {
+          uint32_t delay = 1 + random(random(8) == 0 ? 100000 : 300);
+          periods[i] = random(3) == 0 ? 1 + random(5000) : 0;
+          wheel.arm(timers[i], delay, periods[i]);
+          due[i] = g_tick + delay;
+        }
+      }
+
+      uint32_t fires[kCheckTimers];
+      for (uint32_t i = 0; i < kCheckTimers; i++) {
+        fires[i] = g_timerLogs[i].fires;
+      }
+      tickTimers(1);
+      for (uint32_t i = 0; i < kCheckTimers; i++) {
+        bool ran = g_timerLogs[i].fires != fires[i];
+        matched &= ran == (due[i] == g_tick);
+        matched &= ran == false || g_timerLogs[i].fires == fires[i] + 1;
+        if (ran) {
+          due[i] = periods[i] > 0 ? g_tick + periods[i] : 0;
+        }
+      }
+    }
+    expect(matched, "random timers run exactly when a reference says");
+  }
+
+  return report("timer wheel");
+}
+
+// Whether two panels hold the same pixels in the given box
+static bool samePixels(ILI9341_t3& a, ILI9341_t3& b, int32_t x,
+                       int32_t y, int32_t w, int32_t h) {
+  for (int32_t py = y; py < y + h; py++) {
+    for (int32_t px = x; px < x + w; px++) {
+      if (a.emulator().pixel(px, py) != b.emulator().pixel(px, py)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Whether any pixel in the given box is the given color
+static bool anyPixel(ILI9341_t3& tft, uint16_t color, int32_t x,
+                     int32_t y, int32_t w, int32_t h) {
+  for (int32_t py = y; py < y + h; py++) {
+    for (int32_t px = x; px < x + w; px++) {
+      if (tft.emulator().pixel(px, py) == color) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+static void resetPanel(ILI9341_t3& tft, const ILI9341_t3_font_t& font) {
+  tft.begin();
+  tft.setRotation(1);
+  tft.fillScreen(ILI9341_BLACK);
+  tft.setFont(font);
+  tft.setTextColor(ILI9341_WHITE, ILI9341_BLUE);
+  tft.setTextWrap(false);
+}
+
+bool checkText() {
+  ILI9341_t3 tft(10, 15);
+  ILI9341_t3 reference(9, 20);
+
+  /* More glyphs than drawText() composes at once still all get drawn, the
+   * ones past the first 64 a cell at a time, as print() would draw them
+   */
+  char text[81];
+  std::memset(text, 'i', 80);
+  std::memcpy(text + 70, "WXYZ", 4);
+  text[80] = '\0';
+  resetPanel(tft, Arial_8);
+  resetPanel(reference, Arial_8);
+  tft.setCursor(2, 10);
+  tft.drawText(text);
+  reference.setCursor(2, 10);
+  reference.print(text);
+  expect(tft.getCursorX() == reference.getCursorX(),
+         "drawText() leaves the cursor past glyphs beyond the first 64");
+  expect(samePixels(tft, reference, 0, 0, tft.width(), 40),
+         "drawText() draws glyphs beyond the first 64");
+
+  // In a box, glyphs beyond the first 64 are kept inside it
+  resetPanel(tft, Arial_8);
+  tft.setCursor(2, 50);
+  tft.drawText(text, 0, 48, 180, 20);
+  expect(anyPixel(tft, ILI9341_WHITE, 0, 48, 180, 20),
+         "drawText() in a box draws the text");
+  expect(!anyPixel(tft, ILI9341_WHITE, 180, 0, tft.width() - 180, 80) &&
+             !anyPixel(tft, ILI9341_BLUE, 180, 0, tft.width() - 180, 80),
+         "drawText() in a box keeps glyphs beyond the first 64 inside it");
+
+  return report("text");
+}
+
+// Records a row of small rectangles, as many as it's told to
+class OverflowNode : public Node {
+ public:
+  OverflowNode() : Node("Overflow") {}
+
+  bool drawDisplay(Display& display, uint32_t i) {
+    return drawRecorded(display, i);
+  }
+
+  uint32_t rects = 0;
+
+ protected:
+  bool record(Display& display, uint32_t i,
+              ILI9341_t3_BandRenderer& renderer) override {
+    bool recorded = true;
+    for (uint32_t j = 0; j < rects; j++) {
+      recorded &= renderer.fillRect(4 * j, 0, 2, 2, ILI9341_WHITE);
+    }
+    return recorded;
+  }
+};
+
+bool checkDisplayList() {
+  ILI9341_t3 tft(10, 15);
+  resetPanel(tft, Arial_8);
+  static uint16_t bands[2][ILI9341_TFTHEIGHT * 4];
+  ILI9341_t3_BandRenderer renderer(bands[0], bands[1], ILI9341_TFTHEIGHT * 4);
+  DisplayList list;
+  DirtyRegion dirty;
+
+  uint16_t pixels[4] = {ILI9341_RED, ILI9341_RED, ILI9341_RED, ILI9341_RED};
+  renderer.writeRect(10, 10, 2, 2, pixels);
+  list.render(tft, renderer, dirty);
+  ILI9341_t3::waitAsync();
+  expect(tft.emulator().pixel(11, 11) == ILI9341_RED,
+         "a new writeRect() is painted");
+
+  // Pixels changed in place are repainted once the generation changes
+  pixels[3] = ILI9341_GREEN;
+  renderer.clear();
+  renderer.writeRect(10, 10, 2, 2, pixels, 1);
+  list.render(tft, renderer, dirty);
+  ILI9341_t3::waitAsync();
+  expect(tft.emulator().pixel(11, 11) == ILI9341_GREEN,
+         "a writeRect() with a new generation is repainted");
+
+  tft.emulator().resetStats();
+  renderer.clear();
+  renderer.writeRect(10, 10, 2, 2, pixels, 1);
+  list.render(tft, renderer, dirty);
+  ILI9341_t3::waitAsync();
+  expect(tft.emulator().stats().pixels == 0,
+         "an unchanged list repaints nothing");
+
+  /* These two rectangles' signatures collide on a 64-bit host, so only
+   * comparing the commands themselves tells them apart
+   */
+  renderer.clear();
+  renderer.fillRect(35, 143, 6, 4, 53487);
+  list.render(tft, renderer, dirty);
+  renderer.clear();
+  renderer.fillRect(122, 178, 3, 15, 18730);
+  list.render(tft, renderer, dirty);
+  ILI9341_t3::waitAsync();
+  expect(tft.emulator().pixel(123, 180) == 18730 &&
+             tft.emulator().pixel(36, 144) == ILI9341_BLACK,
+         "a command whose signature matches a different one is repainted");
+
+  // A frame too big for the list is left for the node to draw another way
+  OverflowNode node;
+  DisplayList lists[Node::k_numDisplays];
+  node.setRenderer(&renderer, lists);
+  node.rects = ILI9341_t3_BandRenderer::k_maxCommands + 1;
+  tft.emulator().resetStats();
+  expect(!node.drawDisplay(tft, 0) && tft.emulator().stats().pixels == 0 &&
+             node.dirty[0].size() == 1 &&
+             node.dirty[0][0].w >= tft.width() &&
+             node.dirty[0][0].h >= tft.height(),
+         "a frame that overflows the list leaves the display fully dirty");
+
+  // Once it fits again, the whole display is repainted from the list
+  node.rects = 2;
+  node.dirty[0].clear();
+  expect(node.drawDisplay(tft, 0), "a frame that fits is drawn");
+  ILI9341_t3::waitAsync();
+  expect(tft.emulator().stats().pixels ==
+             uint32_t(tft.width() * tft.height()),
+         "the frame after an overflow repaints the whole display");
+
+  return report("display list");
+}
+
+/* Anti-aliased fixture fonts with one glyph, 'A': 4 by 2 pixels advancing 5,
+ * with coverage rising across the top row and falling across the bottom one.
+ * The 2 bit font's 0-3 and the 4 bit font's 0, 5, 10 and 15 both come out as
+ * steps 0, 5, 10 and 15 of the blend table.
+ */
+static const uint8_t kAntiAliasedIndex[] = {0};
+static const uint8_t kAntiAliased2Data[] = {0x08, 0x40, 0x28, 0x1B, 0xE4};
+static const uint8_t kAntiAliased4Data[] = {0x08, 0x40, 0x28, 0x05,
+                                            0xAF, 0xFA, 0x50};
+static const ILI9341_t3_font_t kAntiAliased2 = {
+    kAntiAliasedIndex, nullptr, kAntiAliased2Data, 23, 1, 'A', 'A', 0, 0, 8,
+    4, 4, 3, 3, 4, 4, 2};
+static const ILI9341_t3_font_t kAntiAliased4 = {
+    kAntiAliasedIndex, nullptr, kAntiAliased4Data, 23, 2, 'A', 'A', 0, 0, 8,
+    4, 4, 3, 3, 4, 4, 2};
+static const uint32_t kAntiAliasedSteps[2][4] = {{0, 5, 10, 15},
+                                                 {15, 10, 5, 0}};
+
+// Step a of the 16 from bg to fg, rounding each channel to nearest
+static uint16_t blendStep(uint16_t fg, uint16_t bg, uint32_t a) {
+  uint32_t r = ((fg >> 11) * a + (bg >> 11) * (15 - a) + 7) / 15;
+  uint32_t g =
+      (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (15 - a) + 7) / 15;
+  uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (15 - a) + 7) / 15;
+  return (r << 11) | (g << 5) | b;
+}
+
+/* Whether the fixture glyph at (x, y) has the colors blending fg over bg
+ * gives it. With threshold set, pixels at least half covered are fg and the
+ * rest keep bg instead.
+ */
+static bool antiAliasedGlyphAt(ILI9341_t3& tft, int32_t x, int32_t y,
+                               uint16_t fg, uint16_t bg,
+                               bool threshold = false) {
+  for (uint32_t row = 0; row < 2; row++) {
+    for (uint32_t col = 0; col < 4; col++) {
+      uint32_t a = kAntiAliasedSteps[row][col];
+      uint16_t expected = threshold ? (a >= 8 ? fg : bg) : blendStep(fg, bg, a);
+      if (tft.emulator().pixel(x + col, y + row) != expected) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool checkAntiAliasedText() {
+  ILI9341_t3 tft(10, 15);
+  static uint16_t bands[2][ILI9341_TFTHEIGHT * 4];
+  ILI9341_t3_BandRenderer renderer(bands[0], bands[1], ILI9341_TFTHEIGHT * 4);
+
+  const ILI9341_t3_font_t* fonts[] = {&kAntiAliased2, &kAntiAliased4};
+  for (const ILI9341_t3_font_t* font : fonts) {
+    resetPanel(tft, *font);
+
+    // An opaque cell blends against the background, and pads the advance
+    tft.setCursor(10, 10);
+    tft.print("A");
+    expect(antiAliasedGlyphAt(tft, 10, 10, ILI9341_WHITE, ILI9341_BLUE) &&
+               tft.emulator().pixel(14, 10) == ILI9341_BLUE &&
+               tft.getCursorX() == 15,
+           "an opaque anti-aliased glyph blends against the background");
+
+    tft.setCursor(10, 20);
+    tft.drawText("AA");
+    expect(antiAliasedGlyphAt(tft, 10, 20, ILI9341_WHITE, ILI9341_BLUE) &&
+               antiAliasedGlyphAt(tft, 15, 20, ILI9341_WHITE, ILI9341_BLUE) &&
+               tft.getCursorX() == 20,
+           "drawText() blends anti-aliased glyphs against the background");
+
+    // The band renderer blends against black, over whatever is below
+    renderer.clear();
+    renderer.fillRect(40, 30, 2, 2, ILI9341_RED);
+    renderer.drawText("A", 40, 30, *font, ILI9341_WHITE);
+    renderer.render(tft, 40, 30, 8, 4);
+    ILI9341_t3::waitAsync();
+    expect(tft.emulator().pixel(40, 30) == ILI9341_RED &&
+               tft.emulator().pixel(41, 30) ==
+                   blendStep(ILI9341_WHITE, ILI9341_BLACK, 5) &&
+               tft.emulator().pixel(42, 30) ==
+                   blendStep(ILI9341_WHITE, ILI9341_BLACK, 10) &&
+               tft.emulator().pixel(43, 31) ==
+                   blendStep(ILI9341_WHITE, ILI9341_BLACK, 0),
+           "the band renderer blends anti-aliased text against black");
+
+    // With no background, pixels at least half covered are drawn solid
+    tft.fillRect(10, 40, 8, 4, ILI9341_RED);
+    tft.setTextColor(ILI9341_WHITE);
+    tft.setCursor(10, 40);
+    tft.print("A");
+    expect(antiAliasedGlyphAt(tft, 10, 40, ILI9341_WHITE, ILI9341_RED, true),
+           "transparent anti-aliased text draws pixels at least half covered");
+  }
+
+  return report("anti-aliased text");
+}
+
+/* A fixture font with a sparse table: 'A' from the anti-aliased fonts above,
+ * plus U+00E9, 2 by 2 pixels advancing 3, and U+2192, 3 by 1 on the baseline
+ * advancing 4, both fully covered
+ */
+static const uint8_t kSparseIndex[] = {0, 5, 9};
+static const uint8_t kSparseUnicode[] = {0x00, 0x02, 0x00, 0xE9, 0x21, 0x92};
+static const uint8_t kSparseData[] = {0x08, 0x40, 0x28, 0x1B, 0xE4,
+                                      0x04, 0x40, 0x18, 0xFF,
+                                      0x06, 0x20, 0x20, 0xFC};
+static const ILI9341_t3_font_t kSparse = {
+    kSparseIndex, kSparseUnicode, kSparseData, 23, 1, 'A', 'A', 0, 0, 8, 4, 4,
+    3, 3, 4, 4, 2};
+
+/* Prints str at (x, y) on a cleared area and returns how far the cursor moved,
+ * or -1 if anything but the pixels set in expected ({x, y} pairs, ending with
+ * {-1, -1}) was drawn white
+ */
+static int32_t printAndCheck(ILI9341_t3& tft, const char* str, int32_t x,
+                             int32_t y, const int32_t (*expected)[2]) {
+  tft.fillRect(x, y, 16, 4, ILI9341_BLACK);
+  tft.setCursor(x, y);
+  tft.print(str);
+  for (int32_t py = y; py < y + 4; py++) {
+    for (int32_t px = x; px < x + 16; px++) {
+      bool lit = false;
+      for (uint32_t i = 0; expected[i][0] >= 0; i++) {
+        lit |= expected[i][0] == px - x && expected[i][1] == py - y;
+      }
+      if ((tft.emulator().pixel(px, py) == ILI9341_WHITE) != lit) {
+        return -1;
+      }
+    }
+  }
+  return tft.getCursorX() - x;
+}
+
+bool checkSparseFont() {
+  ILI9341_t3 tft(10, 15);
+  resetPanel(tft, kSparse);
+  tft.setTextColor(ILI9341_WHITE);
+
+  static const int32_t kNothing[][2] = {{-1, -1}};
+  static const int32_t kA[][2] = {{2, 0}, {3, 0}, {0, 1}, {1, 1}, {-1, -1}};
+  static const int32_t kEAcute[][2] = {{0, 0}, {1, 0}, {0, 1}, {1, 1},
+                                       {-1, -1}};
+  static const int32_t kArrow[][2] = {{0, 1}, {1, 1}, {2, 1}, {-1, -1}};
+
+  expect(printAndCheck(tft, "\xC3\xA9", 10, 10, kEAcute) == 3,
+         "a two byte sequence draws its glyph from the sparse table");
+  expect(printAndCheck(tft, "\xE2\x86\x92", 10, 10, kArrow) == 4,
+         "a three byte sequence draws its glyph from the sparse table");
+  expect(printAndCheck(tft, "\xC3\xA8", 10, 10, kNothing) == 0 &&
+             printAndCheck(tft, "\xE2\x86\x93", 10, 10, kNothing) == 0,
+         "a character missing from the sparse table draws nothing");
+  expect(printAndCheck(tft, "\xE2\x86" "A", 10, 10, kA) == 5,
+         "a truncated sequence is dropped and the next character drawn");
+  expect(printAndCheck(tft, "\x86" "A", 10, 10, kA) == 5,
+         "a stray continuation byte is a character of its own");
+
+  // drawText() decodes the same way, counting each character once
+  tft.setTextColor(ILI9341_WHITE, ILI9341_BLACK);
+  tft.setCursor(10, 20);
+  tft.drawText("A\xE2\x86\x92\xC3\xA8\xC3\xA9");
+  expect(tft.getCursorX() == 22 &&
+             tft.emulator().pixel(15, 21) == ILI9341_WHITE &&
+             tft.emulator().pixel(19, 21) == ILI9341_WHITE,
+         "drawText() draws sparse glyphs from UTF-8 text");
+
+  return report("sparse font");
+}
@@ -0,0 +1,18 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+/* Self-checks for the firmware's hardware-independent pieces, and for drawing
+ * paths the bench's screens don't exercise, checked against an emulated
+ * panel's pixels. Run by the display bench. Each prints a line saying whether
+ * it passed, along with anything that went wrong, and returns false if
+ * something did.
+ */
+
+bool checkEventQueue();
+bool checkVerticalDebouncer();
+bool checkTimerWheel();
+bool checkText();
+bool checkDisplayList();
+bool checkAntiAliasedText();
+bool checkSparseFont();
@@ -7,25 +7,85 @@
  */
 #include "libs/font_Arial.h"
 
-DashNode::DashNode(const char* nameStr) : Node(nameStr) {}
+// Only the characters the dash draws; see libs/font_subsets.txt
+#include "libs/font_subsets.h"
+
+DashNode::DashNode(const char* nameStr)
+    : Node(nameStr),
+      m_speed(0, 50, 2, Arial_96_Dash, ILI9341_YELLOW, ILI9341_BLACK, 'X') {
+  m_speed.setTearFree(true);
+}
 
 void DashNode::draw(Display* displays) {
+  // The speed gauge paints its own cells opaquely, so dirty areas under it
+  // are left to the gauge rather than cleared first
+  if (dirty[0].intersects(m_speed.bounds(displays[0]))) {
+    m_speed.invalidate();
+  }
+
+  bool direct = m_renderer == nullptr;
+  if (!direct) {
+    // A display whose frame doesn't fit in the display list is left fully
+    // dirty and drawn directly instead
+    direct |= !drawRecorded(displays[0], 0, m_speed.bounds(displays[0]));
+    direct |= !drawRecorded(displays[1], 1);
+  }
+  if (direct) {
+    drawDirect(displays);
+  }
+
+  m_speed.draw(displays[0]);
+}
+
+void DashNode::latch() {
+  Node::latch();
+  if (m_mphChanged.exchange(false)) {
+    m_speed.setValue(m_mph);
+  }
+}
+
+void DashNode::setSpeed(uint32_t mph) {
+  m_mph = mph;
+  m_mphChanged = true;
+}
+
+void DashNode::drawDirect(Display* displays) {
   // display 1
-  displays[0].fillScreen(ILI9341_BLACK);
-  displays[0].setFont(Arial_96);
-  displays[0].setCursor(0, 50);
-  displays[0].print("XX");
-  displays[0].setFont(Arial_28);
-  displays[0].setCursor(200, 117);
-  displays[0].print("mph");
+  if (!dirty[0].isEmpty()) {
+    dirty[0].fill(displays[0], ILI9341_BLACK, m_speed.bounds(displays[0]));
+    dirty[0].clear();
+
+    displays[0].setTextColor(ILI9341_YELLOW);
+    displays[0].setFont(Arial_28);
+    displays[0].setCursor(200, 117);
+    displays[0].print("mph");
+  }
 
   // display 2
-  displays[1].fillScreen(ILI9341_BLACK);
-  displays[1].setFont(Arial_48);
-  displays[1].setCursor(10, 10);
-  displays[1].print("FULL");
-  displays[1].setCursor(10, 80);
-  displays[1].print("100");
-  displays[1].setCursor(10, 150);
-  displays[1].print("SLAMUR");
+  if (!dirty[1].isEmpty()) {
+    dirty[1].fill(displays[1], ILI9341_BLACK);
+    dirty[1].clear();
+
+    displays[1].setTextColor(ILI9341_YELLOW);
+    displays[1].setFont(Arial_48_Dash);
+    displays[1].setCursor(10, 10);
+    displays[1].print("FULL");
+    displays[1].setCursor(10, 80);
+    displays[1].print("100");
+    displays[1].setCursor(10, 150);
+    displays[1].print("SLAMUR");
+  }
+}
+
+bool DashNode::record(Display& display, uint32_t i,
+                      ILI9341_t3_BandRenderer& renderer) {
+  if (i == 0) {
+    return renderer.drawText("mph", 200, 117, Arial_28, ILI9341_YELLOW);
+  }
+  bool recorded =
+      renderer.drawText("FULL", 10, 10, Arial_48_Dash, ILI9341_YELLOW);
+  recorded &= renderer.drawText("100", 10, 80, Arial_48_Dash, ILI9341_YELLOW);
+  recorded &=
+      renderer.drawText("SLAMUR", 10, 150, Arial_48_Dash, ILI9341_YELLOW);
+  return recorded;
 }
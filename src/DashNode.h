@@ -2,11 +2,32 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "Node.h"
+#include "NumericGauge.h"
 
 class DashNode : public Node {
  public:
   explicit DashNode(const char* nameStr = "- - no name - -");
 
   void draw(Display* displays) override;
+
+  void latch() override;
+
+  /* Safe to call from an ISR. The next frame latches the value, then repaints
+   * only the speed digits that changed.
+   */
+  void setSpeed(uint32_t mph);
+
+ protected:
+  bool record(Display& display, uint32_t i,
+              ILI9341_t3_BandRenderer& renderer) override;
+
+ private:
+  void drawDirect(Display* displays);
+
+  NumericGauge m_speed;
+  std::atomic<uint32_t> m_mph{0};
+  std::atomic<bool> m_mphChanged{false};
 };
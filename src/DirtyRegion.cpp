@@ -0,0 +1,115 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "DirtyRegion.h"
+
+#include <algorithm>
+
+Rect::Rect(int16_t x, int16_t y, int16_t w, int16_t h)
+    : x(x), y(y), w(w), h(h) {}
+
+bool Rect::intersects(const Rect& rhs) const {
+  return !intersected(rhs).isEmpty();
+}
+
+Rect Rect::intersected(const Rect& rhs) const {
+  int16_t left = std::max(x, rhs.x);
+  int16_t top = std::max(y, rhs.y);
+  int16_t right = std::min(x + w, rhs.x + rhs.w);
+  int16_t bottom = std::min(y + h, rhs.y + rhs.h);
+  return Rect(left, top, right - left, bottom - top);
+}
+
+Rect Rect::united(const Rect& rhs) const {
+  if (isEmpty()) {
+    return rhs;
+  }
+  if (rhs.isEmpty()) {
+    return *this;
+  }
+
+  int16_t left = std::min(x, rhs.x);
+  int16_t top = std::min(y, rhs.y);
+  int16_t right = std::max(x + w, rhs.x + rhs.w);
+  int16_t bottom = std::max(y + h, rhs.y + rhs.h);
+  return Rect(left, top, right - left, bottom - top);
+}
+
+uint32_t Rect::subtracted(const Rect& rhs, Rect out[4]) const {
+  Rect overlap = intersected(rhs);
+  if (overlap.isEmpty()) {
+    out[0] = *this;
+    return isEmpty() ? 0 : 1;
+  }
+
+  // Full-width bands above and below the overlap, then the pieces to its left
+  // and right
+  uint32_t count = 0;
+  Rect pieces[4] = {
+      Rect(x, y, w, overlap.y - y),
+      Rect(x, overlap.y + overlap.h, w, y + h - (overlap.y + overlap.h)),
+      Rect(x, overlap.y, overlap.x - x, overlap.h),
+      Rect(overlap.x + overlap.w, overlap.y, x + w - (overlap.x + overlap.w),
+           overlap.h)};
+  for (const auto& piece : pieces) {
+    if (!piece.isEmpty()) {
+      out[count++] = piece;
+    }
+  }
+  return count;
+}
+
+void DirtyRegion::add(const Rect& rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+
+  // Absorb every tracked rectangle the new one overlaps so entries stay
+  // disjoint. A merge can grow the rectangle into others, so rescan after each.
+  Rect merged = rect;
+  uint32_t i = 0;
+  while (i < m_numRects) {
+    if (m_rects[i].intersects(merged)) {
+      merged = merged.united(m_rects[i]);
+      m_rects[i] = m_rects[--m_numRects];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (m_numRects == k_maxRects) {
+    for (i = 0; i < m_numRects; i++) {
+      merged = merged.united(m_rects[i]);
+    }
+    m_numRects = 0;
+  }
+
+  m_rects[m_numRects++] = merged;
+}
+
+void DirtyRegion::addAll() {
+  // The longest side covers both orientations; fillRect() clips the rest
+  m_rects[0] = Rect(0, 0, ILI9341_TFTHEIGHT, ILI9341_TFTHEIGHT);
+  m_numRects = 1;
+}
+
+bool DirtyRegion::intersects(const Rect& rect) const {
+  for (uint32_t i = 0; i < m_numRects; i++) {
+    if (m_rects[i].intersects(rect)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void DirtyRegion::fill(ILI9341_t3& display, uint16_t color,
+                       const Rect& except) const {
+  for (uint32_t i = 0; i < m_numRects; i++) {
+    Rect pieces[4];
+    uint32_t count = m_rects[i].subtracted(except, pieces);
+    for (uint32_t j = 0; j < count; j++) {
+      const Rect& rect = pieces[j];
+      display.fillRect(rect.x, rect.y, rect.w, rect.h, color);
+    }
+  }
+}
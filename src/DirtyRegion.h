@@ -0,0 +1,58 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "libs/ILI9341_t3.h"
+
+struct Rect {
+  int16_t x = 0;
+  int16_t y = 0;
+  int16_t w = 0;
+  int16_t h = 0;
+
+  Rect() = default;
+  Rect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  bool isEmpty() const { return w <= 0 || h <= 0; }
+  bool intersects(const Rect& rhs) const;
+  Rect intersected(const Rect& rhs) const;
+  Rect united(const Rect& rhs) const;
+
+  /* Splits the area of this rectangle outside rhs into at most four disjoint
+   * rectangles and returns how many were written to out
+   */
+  uint32_t subtracted(const Rect& rhs, Rect out[4]) const;
+};
+
+/* Tracks which areas of a display are stale and must be repainted on the next
+ * draw. Overlapping rectangles are merged as they're added so a region never
+ * paints the same pixel twice. When more than k_maxRects disjoint areas are
+ * dirty, they collapse into their bounding box.
+ */
+class DirtyRegion {
+ public:
+  static constexpr uint32_t k_maxRects = 8;
+
+  void add(const Rect& rect);
+
+  // Marks the entire display dirty, regardless of rotation
+  void addAll();
+
+  void clear() { m_numRects = 0; }
+  bool isEmpty() const { return m_numRects == 0; }
+  bool intersects(const Rect& rect) const;
+
+  // Fills every dirty rectangle with the given color, leaving out the area of
+  // except
+  void fill(ILI9341_t3& display, uint16_t color,
+            const Rect& except = Rect()) const;
+
+  uint32_t size() const { return m_numRects; }
+  const Rect& operator[](uint32_t i) const { return m_rects[i]; }
+
+ private:
+  Rect m_rects[k_maxRects];
+  uint32_t m_numRects = 0;
+};
@@ -0,0 +1,67 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "DisplayList.h"
+
+void DisplayList::render(ILI9341_t3& display,
+                         ILI9341_t3_BandRenderer& renderer,
+                         DirtyRegion& region, const Rect& except) {
+  Rect screen(0, 0, display.width(), display.height());
+  if (m_forgotten) {
+    region.add(screen);
+    m_forgotten = false;
+  }
+
+  /* Match the new commands to the old ones in order. An old command skipped
+   * over to reach a match was removed, and a new command with no match was
+   * added, so commands that only trade places in the painting order are
+   * repainted too.
+   */
+  Entry entries[k_maxCommands];
+  uint32_t next = 0;
+  for (uint32_t i = 0; i < renderer.size(); i++) {
+    Entry& entry = entries[i];
+    entry.signature = renderer.signature(i);
+    renderer.bounds(display, i, &entry.bounds.x, &entry.bounds.y,
+                    &entry.bounds.w, &entry.bounds.h);
+    entry.bounds = entry.bounds.intersected(screen);
+
+    uint32_t match = next;
+    while (match < m_numEntries &&
+           (m_entries[match].signature != entry.signature ||
+            !renderer.sameCommand(i, m_last, match))) {
+      match++;
+    }
+    if (match == m_numEntries) {
+      region.add(entry.bounds);
+      continue;
+    }
+    for (; next < match; next++) {
+      region.add(m_entries[next].bounds);
+    }
+    next = match + 1;
+  }
+  for (; next < m_numEntries; next++) {
+    region.add(m_entries[next].bounds);
+  }
+
+  for (uint32_t i = 0; i < region.size(); i++) {
+    Rect pieces[4];
+    uint32_t count = region[i].subtracted(except, pieces);
+    for (uint32_t j = 0; j < count; j++) {
+      const Rect& rect = pieces[j];
+      renderer.render(display, rect.x, rect.y, rect.w, rect.h);
+    }
+  }
+  region.clear();
+
+  m_numEntries = renderer.size();
+  for (uint32_t i = 0; i < m_numEntries; i++) {
+    m_entries[i] = entries[i];
+  }
+  m_last = renderer;
+}
+
+void DisplayList::forget() {
+  m_numEntries = 0;
+  m_forgotten = true;
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "DirtyRegion.h"
+#include "libs/ILI9341_t3.h"
+
+/* Remembers the last frame a band renderer's display list painted on a
+ * display, so the next frame's list can be compared with it and only what
+ * changed repainted. The last list is kept whole, along with each command's
+ * signature, which rules out most mismatches cheaply, and the area it
+ * covered. A command that appeared, disappeared or changed dirties its old and
+ * new areas, and repainting those areas from the whole new list erases
+ * whatever was left behind.
+ */
+class DisplayList {
+ public:
+  static constexpr uint32_t k_maxCommands =
+      ILI9341_t3_BandRenderer::k_maxCommands;
+
+  /* Adds the areas that changed since the last frame to region, then
+   * repaints region, apart from the area of except, from renderer's list and
+   * clears it. renderer's list becomes the last frame.
+   */
+  void render(ILI9341_t3& display, ILI9341_t3_BandRenderer& renderer,
+              DirtyRegion& region, const Rect& except = Rect());
+
+  /* Drops the last frame, for when the display was drawn some other way. The
+   * next render() repaints the whole display.
+   */
+  void forget();
+
+ private:
+  struct Entry {
+    uint32_t signature;
+    Rect bounds;
+  };
+
+  Entry m_entries[k_maxCommands];
+  uint32_t m_numEntries = 0;
+  bool m_forgotten = false;
+
+  // A copy of the last frame's list; it's never rendered, so it has no bands
+  ILI9341_t3_BandRenderer m_last{nullptr, nullptr, 0};
+};
@@ -0,0 +1,54 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+/* Fixed-size ring buffer that passes events from one producer to one
+ * consumer, such as from an ISR to the main loop, without locking. Each side
+ * only advances its own index, and an event is published by the release store
+ * of m_tail after it's been written, so the consumer never sees a slot being
+ * filled. The indices count up freely and wrap through N, which must be a
+ * power of two; all N slots are usable.
+ */
+template <typename T, uint32_t N>
+class EventQueue {
+  static_assert(N > 0 && (N & (N - 1)) == 0, "N must be a power of two");
+
+ public:
+  /* Producer side. Returns false, dropping the event, if the consumer has
+   * fallen N events behind.
+   */
+  bool push(const T& event) {
+    uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == N) {
+      m_dropped++;
+      return false;
+    }
+    m_events[tail % N] = event;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns false if there's no event to take.
+  bool pop(T& event) {
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    event = m_events[head % N];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Events the producer dropped because the queue was full
+  uint32_t dropped() const { return m_dropped; }
+
+ private:
+  T m_events[N];
+  std::atomic<uint32_t> m_head{0};  // next to pop, written by the consumer
+  std::atomic<uint32_t> m_tail{0};  // next to push, written by the producer
+  volatile uint32_t m_dropped = 0;
+};
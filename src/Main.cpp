@@ -6,7 +6,6 @@
 
 #include <stdint.h>
 
-#include <atomic>
 #include <memory>
 
 #include <IntervalTimer.h>
@@ -15,9 +14,12 @@
  *                  72, 96
  */
 #include "DashNode.h"
+#include "EventQueue.h"
 #include "MenuNode.h"
+#include "ScreenCapture.h"
 #include "Teensy.h"
-#include "fs-0-core/ButtonTracker.h"
+#include "TimerWheel.h"
+#include "VerticalDebouncer.h"
 #include "fs-0-core/CANopen.h"
 #include "fs-0-core/CANopenPDO.h"
 #include "fs-0-core/InterruptMutex.h"
@@ -34,9 +36,10 @@ enum ButtonStates {
 };
 
 // timer interrupt handlers
+void _1msISR();
 void _1sISR();
 void _20msISR();
-void _3msISR();
+void canRxISR();
 void timeoutISR();
 
 void btnDebounce();
@@ -49,15 +52,48 @@ constexpr uint32_t kNumBtns = 4;
 // First pin used by buttons. The rest follow in sequentially increasing order.
 constexpr uint32_t kStartBtnPin = 5;
 
-static IntervalTimer g_timeoutInterrupt;
+/* Pins 5 to 8 are all on port D, so one read of its input register samples
+ * every button. These are the buttons' bits in it, in ButtonStates order.
+ */
+constexpr uint32_t kBtnPortBits[kNumBtns] = {CORE_PIN5_BIT, CORE_PIN6_BIT,
+                                             CORE_PIN7_BIT, CORE_PIN8_BIT};
+
+// Buttons are sampled every millisecond; holding one this long reports it held
+constexpr uint32_t kBtnHoldSamples = 500;
+
+/* RAM budget for decoded font glyphs, shared by both displays. The dash screen
+ * needs about 5.8 KB once the speed has shown every digit, and the menus about
+ * 2.5 KB more, so switching screens doesn't evict anything.
+ */
+constexpr uint32_t kGlyphCacheSize = 8704;
+
+/* Each of the dash's two band buffers holds 16 full-width rows (10 KB), so
+ * repaints never need a 150 KB framebuffer
+ */
+constexpr uint32_t kBandPixels = ILI9341_TFTHEIGHT * 16;
+
+/* Every periodic task and the menu timeout run from this, ticked by the one
+ * PIT interrupt, _1msISR(). A tick is 1 ms.
+ */
+static TimerWheel g_timers;
+static Timer g_timeoutTimer(timeoutISR);
 
 static std::unique_ptr<Teensy> g_teensy;
 
 static std::unique_ptr<CANopen> g_canBus;
 
-static std::atomic<uint8_t> g_btnPressEvents{0};
-static std::atomic<uint8_t> g_btnReleaseEvents{0};
-static std::atomic<uint8_t> g_btnHeldEvents{0};
+struct InputEvent {
+  enum Type : uint8_t { Press, Release, Held };
+
+  uint32_t micros;  // when the debouncer saw it
+  uint8_t button;   // one of ButtonStates
+  Type type;
+};
+
+/* Filled by btnDebounce() from the 1 ms ISR and drained by the main loop, so
+ * presses that come faster than the loop runs are queued rather than merged
+ */
+static EventQueue<InputEvent, 32> g_inputEvents;
 
 int main() {
   constexpr uint32_t kTftDC0 = 15;
@@ -66,7 +102,7 @@ int main() {
   constexpr uint32_t kTftCS1 = 9;
   constexpr uint32_t kTftMOSI = 11;
   constexpr uint32_t kTftSCLK = 14;
-  constexpr uint32_t kMenuTimeout = 3000000;  // in ms
+  constexpr uint32_t kMenuTimeout = 3000;  // in ms
 
   // Instantiate display obj and properties; use hardware SPI (#13, #12, #11)
   ILI9341_t3 tft[2] = {ILI9341_t3(kTftCS0, kTftDC0, 255, kTftMOSI, kTftSCLK),
@@ -82,15 +118,34 @@ int main() {
 
   Serial.begin(115200);
 
+  static uint8_t glyphCacheBuf[kGlyphCacheSize];
+  ILI9341_t3_GlyphCache glyphCache(glyphCacheBuf, sizeof(glyphCacheBuf));
+
+  static uint16_t bandBuf[2][kBandPixels];
+  ILI9341_t3_BandRenderer bandRenderer(bandBuf[0], bandBuf[1], kBandPixels);
+
+  // The last frame each display showed, for nodes drawn through bandRenderer
+  static DisplayList displayLists[Node::k_numDisplays];
+
+  /* Both panels get the same init sequence, rotation and clear, so send them
+   * once with both chip selects asserted. The clear goes out while the panels
+   * wake from sleep, before they're turned on, so whatever GRAM held at power
+   * up is never shown.
+   */
+  tft[0].begin(tft[1]);
+  tft[0].setBroadcast(&tft[1]);
+  tft[0].setRotation(1);
+  tft[0].fillScreen(ILI9341_BLACK);
+  tft[0].displayOn();
+  tft[0].setBroadcast(nullptr);
+
   uint32_t i;
   for (i = 0; i < 2; i++) {
-    tft[i].begin();
-    tft[i].setRotation(1);
-    tft[i].fillScreen(ILI9341_BLACK);
     tft[i].setTextColor(ILI9341_YELLOW);
     /* tft[0].setTextSize(2); */
     tft[i].setFont(Arial_20);
     tft[i].setCursor(0, 4);  // (x,y)
+    tft[i].setGlyphCache(&glyphCache);
   }
 
   // init Teensy pins
@@ -102,11 +157,11 @@ int main() {
   // create the node tree
   auto head = std::make_unique<DashNode>();  // dash is tree head
   head->m_nodeType = NodeType::DashHead;
+  head->setRenderer(&bandRenderer, displayLists);
 
   // main menu
   auto menuHead = std::make_unique<MenuNode>();
   menuHead->m_nodeType = NodeType::MenuHead;
-  head->addChild(std::move(menuHead));
 
   auto sensors = std::make_unique<MenuNode>("Sensors");
   sensors->addChild(std::make_unique<Node>("Sensor 1"));
@@ -116,6 +171,7 @@ int main() {
 
   menuHead->addChild(std::make_unique<MenuNode>("Settings"));
   menuHead->addChild(std::make_unique<MenuNode>("Other"));
+  head->addChild(std::move(menuHead));
 
   g_teensy = std::make_unique<Teensy>(std::move(head));
 
@@ -123,22 +179,52 @@ int main() {
    * children
    */
 
-  IntervalTimer _1sInterrupt;
-  _1sInterrupt.begin(_1sISR, 1000000);
+  static Timer heartbeatTimer(_1sISR);
+  g_timers.arm(heartbeatTimer, 1000, 1000);
+
+  static Timer pinTimer(_20msISR);
+  g_timers.arm(pinTimer, 20, 20);
+
+  static Timer debounceTimer(btnDebounce);
+  g_timers.arm(debounceTimer, 1, 1);
 
-  IntervalTimer _20msInterrupt;
-  _20msInterrupt.begin(_20msISR, 20000);
+  static Timer canRxTimer(canRxISR);
+  g_timers.arm(canRxTimer, 3, 3);
 
-  IntervalTimer _3msInterrupt;
-  _3msInterrupt.begin(_3msISR, 3000);
+  IntervalTimer tickInterrupt;
+  tickInterrupt.begin(_1msISR, 1000);
 
   /* Used as temporary safe storage for current node pointer, which could
    * otherwise be changed by an ISR
    */
   Node* tempNode;
 
+  // Node whose contents are currently on the displays
+  Node* drawnNode = nullptr;
+
   InterruptMutex interruptMut;
 
+  // Gives the menu another kMenuTimeout before it returns to the dash
+  auto restartMenuTimeout = [&] {
+    std::lock_guard<InterruptMutex> lock(interruptMut);
+    g_timers.arm(g_timeoutTimer, kMenuTimeout);
+  };
+
+  /* Sending kCaptureToggle over serial starts streaming the panels' contents
+   * in turn, for tools/CaptureDecode.cpp to turn into images, and sending it
+   * again stops it. Each loop reads back kCaptureReadMicros of a row at most.
+   * A frame whose rows get split by other output is dropped by the decoder.
+   */
+  constexpr char kCaptureToggle = 'c';
+  constexpr uint32_t kCaptureReadMicros = 250;
+  static ScreenCapture capture;
+  uint8_t capturePanel = 0;
+  bool captureEnabled = false;
+
+  // When the last press handled happened, until the redraw it caused is done
+  uint32_t lastInputMicros = 0;
+  bool inputPending = false;
+
   Serial.println("[STATUS]: Initialized.");
 
   while (1) {
@@ -151,14 +237,23 @@ int main() {
       g_canBus->printRxAll();
     }
 
-    // service main state machine
-    switch (g_teensy->displayState) {
-      // Display dash only
-      case DisplayState::Dash:
-        /* Check if should display menu. This btnPress is not counted for menu
-         * navigation.
-         */
-        if (g_btnPressEvents != kBtnNone) {
+    /* Service the main state machine once per press, in the order they
+     * happened. Releases and holds aren't used yet.
+     */
+    InputEvent event;
+    while (g_inputEvents.pop(event)) {
+      if (event.type != InputEvent::Press) {
+        continue;
+      }
+      lastInputMicros = event.micros;
+      inputPending = true;
+
+      switch (g_teensy->displayState) {
+        // Display dash only
+        case DisplayState::Dash:
+          /* Any press displays the menu. It isn't counted for menu
+           * navigation.
+           */
           {
             std::lock_guard<InterruptMutex> lock(interruptMut);
 
@@ -170,140 +265,171 @@ int main() {
           g_teensy->displayState = DisplayState::Menu;
           g_teensy->redrawScreen = true;
 
-          // Consume all button events
-          g_btnPressEvents = kBtnNone;
-
           // Start timeout
-          g_timeoutInterrupt.begin(timeoutISR, kMenuTimeout);
+          restartMenuTimeout();
 
           Serial.println("[EVENT]: Button pressed.");
-        }
-        break;
-      // Display members of menu node tree
-      case DisplayState::Menu:
-        // Up, backward through child highlighted
-        if (g_btnPressEvents & kBtnUp) {
-          // Reset timeout interrupt
-          g_timeoutInterrupt.end();
-          g_timeoutInterrupt.begin(timeoutISR, kMenuTimeout);
-
-          {
-            std::lock_guard<InterruptMutex> lock(interruptMut);
-
-            tempNode = g_teensy->currentNode;
-          }
-
-          if (tempNode->childIndex > 0) {
-            tempNode->childIndex--;
-          } else {
-            tempNode->childIndex = tempNode->children.size() - 1;
-          }
+          break;
+        // Display members of menu node tree
+        case DisplayState::Menu:
+          // Up, backward through child highlighted
+          if (event.button == kBtnUp) {
+            // Reset timeout
+            restartMenuTimeout();
 
-          g_teensy->redrawScreen = true;
+            {
+              std::lock_guard<InterruptMutex> lock(interruptMut);
 
-          g_btnPressEvents &= ~kBtnUp;
+              tempNode = g_teensy->currentNode;
+            }
 
-          Serial.println("[EVENT]: Button <UP> pressed.");
-        }
+            if (tempNode->childIndex > 0) {
+              tempNode->childIndex--;
+            } else {
+              tempNode->childIndex = tempNode->children.size() - 1;
+            }
 
-        // Right, into child
-        if (g_btnPressEvents & kBtnRight) {
-          // Reset timeout interrupt
-          g_timeoutInterrupt.end();
-          g_timeoutInterrupt.begin(timeoutISR, kMenuTimeout);
+            g_teensy->redrawScreen = true;
 
-          // Make sure node has children
-          {
-            std::lock_guard<InterruptMutex> lock(interruptMut);
-            tempNode = g_teensy->currentNode;
+            Serial.println("[EVENT]: Button <UP> pressed.");
           }
 
-          if (tempNode->children[tempNode->childIndex]->children.size() > 0) {
-            // Move to the new node
+          // Right, into child
+          if (event.button == kBtnRight) {
+            // Reset timeout
+            restartMenuTimeout();
+
+            // Make sure node has children
             {
               std::lock_guard<InterruptMutex> lock(interruptMut);
-              g_teensy->currentNode =
-                  tempNode->children[tempNode->childIndex].get();
+              tempNode = g_teensy->currentNode;
             }
-            g_teensy->redrawScreen = true;
-          } else {
-            // (should show that item has no children)
+
+            Node* child = tempNode->children[tempNode->childIndex].get();
+            if (child->children.size() > 0) {
+              // Move to the new node
+              {
+                std::lock_guard<InterruptMutex> lock(interruptMut);
+                g_teensy->currentNode = child;
+              }
+              g_teensy->redrawScreen = true;
+            } else {
+              // (should show that item has no children)
+            }
+
+            Serial.println("[EVENT]: Button <RIGHT> pressed.");
           }
 
-          g_btnPressEvents &= ~kBtnRight;
+          // Down, forward through child highlighted
+          if (event.button == kBtnDown) {
+            // Reset timeout
+            restartMenuTimeout();
 
-          Serial.println("[EVENT]: Button <RIGHT> pressed.");
-        }
+            {
+              std::lock_guard<InterruptMutex> lock(interruptMut);
+              tempNode = g_teensy->currentNode;
+            }
 
-        // Down, forward through child highlighted
-        if (g_btnPressEvents & kBtnDown) {
-          // Reset timeout interrupt
-          g_timeoutInterrupt.end();
-          g_timeoutInterrupt.begin(timeoutISR, kMenuTimeout);
+            if (tempNode->childIndex == tempNode->children.size() - 1) {
+              tempNode->childIndex = 0;
+            } else {
+              tempNode->childIndex++;
+            }
 
-          {
-            std::lock_guard<InterruptMutex> lock(interruptMut);
-            tempNode = g_teensy->currentNode;
-          }
+            g_teensy->redrawScreen = true;
 
-          if (tempNode->childIndex == tempNode->children.size() - 1) {
-            tempNode->childIndex = 0;
-          } else {
-            tempNode->childIndex++;
+            Serial.println("[EVENT]: Button <DOWN> pressed.");
           }
 
-          g_teensy->redrawScreen = true;
+          // Left, out to parent
+          if (event.button == kBtnLeft) {
+            // Reset timeout
+            restartMenuTimeout();
 
-          g_btnPressEvents &= ~kBtnDown;
+            {
+              std::lock_guard<InterruptMutex> lock(interruptMut);
 
-          Serial.println("[EVENT]: Button <DOWN> pressed.");
-        }
+              g_teensy->currentNode = g_teensy->currentNode->parent;
+              tempNode = g_teensy->currentNode;
+            }
 
-        // Left, out to parent
-        if (g_btnPressEvents & kBtnLeft) {
-          // Reset timeout interrupt
-          g_timeoutInterrupt.end();
-          g_timeoutInterrupt.begin(timeoutISR, kMenuTimeout);
+            if (tempNode->m_nodeType == NodeType::DashHead) {
+              g_teensy->displayState = DisplayState::Dash;
 
-          {
-            std::lock_guard<InterruptMutex> lock(interruptMut);
+              std::lock_guard<InterruptMutex> lock(interruptMut);
+              g_timers.cancel(g_timeoutTimer);
+            }
 
-            g_teensy->currentNode = g_teensy->currentNode->parent;
-            tempNode = g_teensy->currentNode;
-          }
+            g_teensy->redrawScreen = true;
 
-          if (tempNode->m_nodeType == NodeType::DashHead) {
-            g_teensy->displayState = DisplayState::Dash;
+            Serial.println("[EVENT]: Button <LEFT> pressed.");
           }
-
-          g_teensy->redrawScreen = true;
-
-          g_btnPressEvents &= ~kBtnLeft;
-
-          Serial.println("[EVENT]: Button <LEFT> pressed.");
-        }
-        break;
+          break;
+      }
     }
 
-    // Consume all unused events
-    g_btnReleaseEvents = kBtnNone;
-    g_btnHeldEvents = kBtnNone;
-
     // Update display
     if (g_teensy->redrawScreen) {
-      // Execute draw function for node
+      /* Only the snapshot is taken with interrupts masked; the repaint itself
+       * can take tens of milliseconds, so it runs with CAN RX and debouncing
+       * still serviced. A redraw an ISR asks for meanwhile happens next loop.
+       */
+      Node* node;
       {
         std::lock_guard<InterruptMutex> lock(interruptMut);
-        g_teensy->currentNode->draw(tft);
+
+        g_teensy->redrawScreen = false;
+        node = g_teensy->currentNode;
+        node->latch();
       }
 
-      Serial.println("[EVENT]: Redrawing screen.");
+      /* A newly shown node has to paint over everything the last one drew,
+       * starting from unscrolled displays
+       */
+      if (node != drawnNode) {
+        for (auto& display : tft) {
+          display.setScroll(0);
+        }
+        node->invalidate();
+        drawnNode = node;
+      }
+      node->draw(tft);
+
+      Serial.print("[EVENT]: Redrawing screen.");
+      if (inputPending) {
+        Serial.print(" ");
+        Serial.print(micros() - lastInputMicros);
+        Serial.print(" us since input.");
+        inputPending = false;
+      }
+      Serial.println();
+    }
+
+    while (Serial.available() > 0) {
+      if (Serial.read() == kCaptureToggle) {
+        captureEnabled = !captureEnabled;
+
+        // Start on a fresh frame rather than finishing the abandoned one
+        if (captureEnabled) {
+          capture.start(tft[capturePanel], capturePanel);
+          capturePanel ^= 1;
+        }
+      }
+    }
 
-      g_teensy->redrawScreen = false;
+    // Send what fits in the USB buffer without blocking the loop
+    if (captureEnabled && Serial) {
+      if (!capture.busy()) {
+        capture.start(tft[capturePanel], capturePanel);
+        capturePanel ^= 1;
+      }
+      capture.service(Serial, Serial.availableForWrite(), kCaptureReadMicros);
     }
   }
 }
 
+void _1msISR() { g_timers.tick(); }
+
 /**
  * @desc Performs period tasks every second
  */
@@ -314,7 +440,7 @@ void _1sISR() {
 }
 
 void _20msISR() {
-  static uint32_t i, newVal;
+  static uint32_t i, newVal, oldVal;
   static bool valDecreased, valIncreased;
   static Node* tempNode;
 
@@ -323,24 +449,24 @@ void _20msISR() {
   // Check if node's observed pins changed in value and must re-render
   for (i = 0; i < tempNode->numPins; i++) {
     newVal = digitalReadFast(tempNode->pins[i]);
-    valDecreased = newVal - tempNode->pinVals[i] < -kAdcChangeTolerance;
-    valIncreased = newVal - tempNode->pinVals[i] > kAdcChangeTolerance;
+    oldVal = tempNode->pinValFromISR(i);
+    valDecreased = newVal - oldVal < -kAdcChangeTolerance;
+    valIncreased = newVal - oldVal > kAdcChangeTolerance;
     if (valDecreased || valIncreased) {
-      // pin/adc val changed by more than kAdcChangeTolerance
-      tempNode->pinVals[i] = newVal;
+      /* pin/adc val changed by more than kAdcChangeTolerance. draw() may be
+       * reading pinVals, so the node takes the new value at its next latch().
+       */
+      tempNode->setPinValFromISR(i, newVal);
       g_teensy->redrawScreen = true;
     }
   }
 
-  btnDebounce();
   g_canBus->processTxMessages();
 }
 
-void _3msISR() { g_canBus->processRxMessages(); }
+void canRxISR() { g_canBus->processRxMessages(); }
 
 void timeoutISR() {
-  g_timeoutInterrupt.end();
-
   // Return to dash state
   g_teensy->currentNode = g_teensy->currentNode->parent;
 
@@ -349,28 +475,33 @@ void timeoutISR() {
 }
 
 void btnDebounce() {
-  static ButtonTracker<4> upButton(kStartBtnPin, false);
-  static ButtonTracker<4> rightButton(kStartBtnPin + 1, false);
-  static ButtonTracker<4> downButton(kStartBtnPin + 2, false);
-  static ButtonTracker<4> leftButton(kStartBtnPin + 3, false);
-
-  upButton.update();
-  rightButton.update();
-  downButton.update();
-  leftButton.update();
-
-  g_btnPressEvents |= upButton.pressed();
-  g_btnPressEvents |= rightButton.pressed() << 1;
-  g_btnPressEvents |= downButton.pressed() << 2;
-  g_btnPressEvents |= leftButton.pressed() << 3;
-
-  g_btnReleaseEvents |= upButton.released();
-  g_btnReleaseEvents |= rightButton.released() << 1;
-  g_btnReleaseEvents |= downButton.released() << 2;
-  g_btnReleaseEvents |= leftButton.released() << 3;
-
-  g_btnHeldEvents |= upButton.held();
-  g_btnHeldEvents |= rightButton.held() << 1;
-  g_btnHeldEvents |= downButton.held() << 2;
-  g_btnHeldEvents |= leftButton.held() << 3;
+  static VerticalDebouncer debouncer(kBtnHoldSamples);
+
+  // The buttons pull their pins low when pressed. They're debounced in place
+  // in the port's bits, which only need sorting out when one changes.
+  constexpr uint32_t kPortMask = 1 << kBtnPortBits[0] | 1 << kBtnPortBits[1] |
+                                 1 << kBtnPortBits[2] | 1 << kBtnPortBits[3];
+  debouncer.update(~CORE_PIN5_PINREG & kPortMask);
+
+  uint32_t pressed = debouncer.pressed();
+  uint32_t released = debouncer.released();
+  uint32_t held = debouncer.held();
+  if ((pressed | released | held) == 0) {
+    return;
+  }
+
+  uint32_t now = micros();
+  for (uint32_t i = 0; i < kNumBtns; i++) {
+    uint32_t bit = 1 << kBtnPortBits[i];
+    uint8_t button = 1 << i;
+    if (pressed & bit) {
+      g_inputEvents.push({now, button, InputEvent::Press});
+    }
+    if (released & bit) {
+      g_inputEvents.push({now, button, InputEvent::Release});
+    }
+    if (held & bit) {
+      g_inputEvents.push({now, button, InputEvent::Held});
+    }
+  }
 }
@@ -2,34 +2,62 @@
 
 #include "MenuNode.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 
 /* Available sizes: 8, 9, 10, 11, 12, 13, 14, 16, 18, 20, 24, 28, 32, 40, 60,
  *                  72, 96
  */
 #include "libs/font_Arial.h"
+#include "libs/sprites.h"
 
 MenuNode::MenuNode(const char* nameStr) : Node(nameStr) {}
 
 void MenuNode::draw(Display* displays) {
+  if (canScroll(displays[0]) && !m_scrollSynced) {
+    displays[0].setScrollArea(0, k_scrollRows * k_rowHeight);
+    displays[0].setScroll(scrollOffset());
+    m_scrollSynced = true;
+  }
+  scrollToSelection(displays[0]);
+
+  // Moving the highlight only changes the old and new rows and the description
+  if (childIndex != m_drawnChildIndex) {
+    dirty[0].add(rowRect(displays[0], m_drawnChildIndex));
+    dirty[0].add(rowRect(displays[0], childIndex));
+    dirty[1].add(dataRect(displays[1], m_drawnChildIndex));
+    dirty[1].add(dataRect(displays[1], childIndex));
+    m_drawnChildIndex = childIndex;
+  }
+
   // display 1
-  displays[0].fillScreen(ILI9341_BLACK);
-
-  for (uint32_t i = 0; i < children.size(); i++) {
-    displays[0].setCursor(10, (10 + 52 * i));
-    if (i == childIndex) {
-      // invert display of node
-      displays[0].fillRect(0, (0 + 50 * i), 350, 50, ILI9341_YELLOW);
-      displays[0].setTextColor(ILI9341_BLACK);
-      displays[0].print(children[i]->name);
-      displays[0].setTextColor(ILI9341_YELLOW);
+  displays[0].setFont(Arial_28);
+  uint32_t slots = rowSlots(displays[0]);
+  for (uint32_t i = m_firstRow; i < m_firstRow + slots; i++) {
+    Rect row = rowRect(displays[0], i);
+    if (!dirty[0].intersects(row)) {
+      continue;
+    }
+
+    if (i < children.size()) {
+      drawRow(displays[0], i);
     } else {
-      // print regularly
-      displays[0].print(children[i]->name);
-      displays[0].drawFastHLine(0, (50 + 50 * i), 320, ILI9341_YELLOW);
-      displays[0].drawFastHLine(0, (51 + 50 * i), 320, ILI9341_YELLOW);
+      displays[0].fillRect(row.x, row.y, row.w, row.h, ILI9341_BLACK);
+    }
+  }
+
+  // Clear whatever part of the dirty region lies below the rows
+  Rect below(0, slots * k_rowHeight, displays[0].width(),
+             displays[0].height() - slots * k_rowHeight);
+  for (uint32_t i = 0; i < dirty[0].size(); i++) {
+    Rect rect = dirty[0][i].intersected(below);
+    if (!rect.isEmpty()) {
+      displays[0].fillRect(rect.x, rect.y, rect.w, rect.h, ILI9341_BLACK);
     }
   }
+  displays[0].setTextColor(ILI9341_YELLOW);
+  dirty[0].clear();
 
   /*
    * char num = node->childIndex + '0';
@@ -37,14 +65,189 @@ void MenuNode::draw(Display* displays) {
    * displays[0].print({num});
    */
   // display 2
-  displays[1].fillScreen(ILI9341_BLACK);
-  displays[1].setCursor(10, 10);
-  displays[1].setFont(Arial_20);
+  if (!dirty[1].isEmpty()) {
+    // The description paints its own background, so it's left out of the fill
+    char str[k_maxDataChars + 1];
+    const char* lines[k_maxDataLines];
+    Rect data;
+    uint32_t count = 0;
+    if (childIndex < children.size()) {
+      count = layoutData(displays[1], childIndex, str, lines, &data);
+    }
+    bool redrawData = dirty[1].intersects(data);
+    dirty[1].fill(displays[1], ILI9341_BLACK, redrawData ? data : Rect());
+    dirty[1].clear();
+
+    if (redrawData) {
+      displays[1].setFont(Arial_20);
+      displays[1].setTextColor(ILI9341_YELLOW, ILI9341_BLACK);
+      for (uint32_t i = 0; i < count; i++) {
+        int16_t y = data.y + i * Arial_20.line_space;
+        displays[1].setCursor(data.x, y);
+        displays[1].drawText(lines[i], data.x, y, data.w, Arial_20.line_space);
+      }
+    }
+  }
+}
+
+void MenuNode::invalidate() {
+  Node::invalidate();
+
+  // Whatever was shown before may have left the display scrolled elsewhere
+  m_scrollSynced = false;
+}
+
+bool MenuNode::canScroll(const Display& display) {
+  // In rotation 2 the scrolling still runs along y, but backward
+  return display.getRotation() == 0;
+}
+
+uint32_t MenuNode::fullRows(const Display& display) const {
+  if (canScroll(display)) {
+    return k_scrollRows;
+  }
+  return display.height() / k_rowHeight;
+}
+
+uint32_t MenuNode::rowSlots(const Display& display) const {
+  if (canScroll(display)) {
+    return k_scrollRows;
+  }
+  return (display.height() + k_rowHeight - 1) / k_rowHeight;
+}
+
+uint16_t MenuNode::scrollOffset() const {
+  return (m_firstRow % k_scrollRows) * k_rowHeight;
+}
+
+void MenuNode::scrollToSelection(Display& display) {
+  uint32_t rows = fullRows(display);
+  uint32_t first = m_firstRow;
+  if (childIndex < first) {
+    first = childIndex;
+  } else if (childIndex >= first + rows) {
+    first = childIndex - rows + 1;
+  }
+  if (first == m_firstRow) {
+    return;
+  }
+
+  bool oneRow = first == m_firstRow + 1 || first + 1 == m_firstRow;
+  uint32_t exposed = first > m_firstRow ? first + rows - 1 : first;
+  m_firstRow = first;
 
+  if (canScroll(display)) {
+    display.setScroll(scrollOffset());
+
+    // The panel moved the rows already drawn along with the scroll, so only
+    // the row scrolled into view is new
+    if (oneRow) {
+      dirty[0].add(rowRect(display, exposed));
+      return;
+    }
+  }
+  dirty[0].addAll();
+}
+
+Rect MenuNode::rowRect(const Display& display, uint32_t i) const {
+  if (i < m_firstRow || i >= m_firstRow + rowSlots(display)) {
+    return Rect();
+  }
+
+  // Scrolled rows keep their place in the scrolling area; it wraps around
+  if (canScroll(display)) {
+    return Rect(0, k_rowHeight * (i % k_scrollRows), display.width(),
+                k_rowHeight);
+  }
+  return Rect(0, k_rowHeight * (i - m_firstRow), display.width(), k_rowHeight);
+}
+
+uint32_t MenuNode::layoutData(Display& display, uint32_t i, char* str,
+                              const char* lines[k_maxDataLines],
+                              Rect* area) const {
   // std::snprintf() doesn't exist on this platform, so tell the linter to
   // ignore it
-  char str[30];
   std::sprintf(str, "[This is <%s> node data]",  // NOLINT
-               children[childIndex]->name);
-  displays[1].print(str);
+               children[i]->name);
+
+  /* A line's width is the sum of its glyphs' advances, so it's built up from
+   * each word's width and a space's, measuring every word once. Words are cut
+   * out of str where they end, and joined back to their line by restoring the
+   * space before them.
+   */
+  int16_t maxWidth = display.width() - 2 * k_dataMargin;
+  uint16_t space;
+  uint16_t h;
+  display.measureText(Arial_20, " ", &space, &h);
+
+  uint32_t count = 0;
+  uint16_t lineWidth = 0;
+  uint16_t width = 0;
+  char* word = str;
+  while (true) {
+    char* end = word + std::strcspn(word, " ");
+    bool last = *end == '\0';
+    *end = '\0';
+
+    uint16_t w;
+    display.measureText(Arial_20, word, &w, &h);
+    if (count > 0 && lineWidth + space + w <= maxWidth) {
+      word[-1] = ' ';
+      lineWidth += space + w;
+    } else if (count < k_maxDataLines) {
+      // Each line takes at least its first word
+      lines[count++] = word;
+      lineWidth = w;
+    } else {
+      break;
+    }
+    width = std::max(width, lineWidth);
+
+    if (last) {
+      break;
+    }
+    word = end + 1;
+  }
+
+  *area = Rect(k_dataMargin, k_dataMargin, width,
+               count * Arial_20.line_space);
+  return count;
+}
+
+Rect MenuNode::dataRect(Display& display, uint32_t i) const {
+  if (i >= children.size()) {
+    return Rect();
+  }
+
+  char str[k_maxDataChars + 1];
+  const char* lines[k_maxDataLines];
+  Rect area;
+  layoutData(display, i, str, lines, &area);
+  return area;
+}
+
+void MenuNode::drawRow(Display& display, uint32_t i) {
+  Rect row = rowRect(display, i);
+
+  display.setCursor(10, row.y + 10);
+  if (i == childIndex) {
+    // invert display of node
+    display.setTextColor(ILI9341_BLACK, ILI9341_YELLOW);
+    display.drawText(children[i]->name, row.x, row.y, row.w, row.h);
+  } else {
+    // print regularly, with a separator along the bottom of the row
+    display.setTextColor(ILI9341_YELLOW, ILI9341_BLACK);
+    display.drawText(children[i]->name, row.x, row.y, row.w, row.h - 2);
+    display.drawFastHLine(row.x, row.y + row.h - 2, row.w, ILI9341_YELLOW);
+    display.drawFastHLine(row.x, row.y + row.h - 1, row.w, ILI9341_YELLOW);
+  }
+
+  // A caret at the end of the row shows the node can be opened
+  if (children[i]->children.size() > 0) {
+    static const uint16_t selected[] = {ILI9341_BLACK, ILI9341_BLACK};
+    const ILI9341_t3_sprite_t& caret = Sprite_Caret;
+    display.drawSprite(row.x + row.w - caret.width - 10,
+                       row.y + (row.h - 2 - caret.height) / 2, caret,
+                       i == childIndex ? selected : nullptr);
+  }
 }
@@ -9,4 +9,56 @@ class MenuNode : public Node {
   explicit MenuNode(const char* nameStr = "- - no name - -");
 
   void draw(Display* displays) override;
+  void invalidate() override;
+
+  static constexpr int16_t k_rowHeight = 50;
+
+  /* In portrait, the rows are drawn into a hardware scrolling area this many
+   * rows tall, and the lines below it stay fixed
+   */
+  static constexpr uint32_t k_scrollRows = ILI9341_TFTHEIGHT / k_rowHeight;
+
+ private:
+  // Whether the display's hardware scrolling runs along its y axis
+  static bool canScroll(const Display& display);
+
+  // Number of rows display 1 shows in full
+  uint32_t fullRows(const Display& display) const;
+
+  // Number of rows display 1 shows at least partly
+  uint32_t rowSlots(const Display& display) const;
+
+  // Line of the scrolling area shown at the top of display 1
+  uint16_t scrollOffset() const;
+
+  /* Moves the viewport so the selected child's row is fully visible, marking
+   * whatever has to be repainted
+   */
+  void scrollToSelection(Display& display);
+
+  /* Area of display 1 that child i's row is drawn to, including its separator.
+   * It's empty if the row is out of view.
+   */
+  Rect rowRect(const Display& display, uint32_t i) const;
+
+  static constexpr uint32_t k_maxDataChars =
+      sizeof("[This is <> node data]") - 1 + k_maxNodeNameChars;
+  static constexpr uint32_t k_maxDataLines = 3;
+  static constexpr int16_t k_dataMargin = 10;
+
+  /* Writes child i's description, shown on display 2 while it's selected, to
+   * str and breaks it into lines that fit the display, at spaces where it
+   * can. Returns the number of lines and the area of display 2 they cover.
+   */
+  uint32_t layoutData(Display& display, uint32_t i, char* str,
+                      const char* lines[k_maxDataLines], Rect* area) const;
+
+  // Area of display 2 covered by child i's description
+  Rect dataRect(Display& display, uint32_t i) const;
+
+  void drawRow(Display& display, uint32_t i);
+
+  uint32_t m_drawnChildIndex = 0;
+  uint32_t m_firstRow = 0;       // first child in the viewport
+  bool m_scrollSynced = false;  // display 1's scrolling matches m_firstRow
 };
@@ -15,4 +15,54 @@ void Node::addChild(std::unique_ptr<Node> child) {
   children.push_back(std::move(child));
 }
 
-void Node::draw(Display* displays) {}
+void Node::draw(Display* displays) {
+  if (m_renderer == nullptr) {
+    return;
+  }
+
+  for (uint32_t i = 0; i < k_numDisplays; i++) {
+    drawRecorded(displays[i], i);
+  }
+}
+
+void Node::invalidate() {
+  for (auto& region : dirty) {
+    region.addAll();
+  }
+}
+
+void Node::setPinValFromISR(uint32_t i, uint32_t val) {
+  m_pendingPinVals[i] = val;
+  m_invalidatePending = true;
+}
+
+void Node::latch() {
+  if (m_invalidatePending.exchange(false)) {
+    for (uint32_t i = 0; i < numPins; i++) {
+      pinVals[i] = m_pendingPinVals[i];
+    }
+    invalidate();
+  }
+}
+
+void Node::setRenderer(ILI9341_t3_BandRenderer* renderer, DisplayList* lists) {
+  m_renderer = renderer;
+  m_displayLists = lists;
+}
+
+bool Node::record(Display& display, uint32_t i,
+                  ILI9341_t3_BandRenderer& renderer) {
+  return true;
+}
+
+bool Node::drawRecorded(Display& display, uint32_t i, const Rect& except) {
+  m_renderer->clear();
+  if (!record(display, i, *m_renderer)) {
+    // Painting part of the frame would leave out whatever didn't fit
+    m_displayLists[i].forget();
+    dirty[i].addAll();
+    return false;
+  }
+  m_displayLists[i].render(display, *m_renderer, dirty[i], except);
+  return true;
+}
@@ -4,9 +4,12 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
+#include "DirtyRegion.h"
+#include "DisplayList.h"
 #include "libs/ILI9341_t3.h"
 
 /* ILI9341.h defines a swap macro that conflicts with the C++ standard library,
@@ -28,8 +31,42 @@ class Node {
   explicit Node(const char* nameStr);
 
   void addChild(std::unique_ptr<Node> child);
+
+  /* Repaints the parts of each display listed in the node's dirty regions,
+   * then clears them. By default, each display is drawn from what record()
+   * adds to the renderer's display list, along with whatever changed in it
+   * since the last frame; without a renderer, nothing is drawn. A display
+   * whose frame doesn't fit in the display list keeps its last frame and is
+   * tried again, whole, on the next one.
+   */
   virtual void draw(Display* displays);
 
+  // Marks every display fully dirty, e.g. when the node is first shown
+  virtual void invalidate();
+
+  /* Safe to call from an ISR: stores a new reading of pin i, which the next
+   * latch() copies into pinVals, invalidating the node. An ISR mustn't touch
+   * pinVals or the dirty regions itself while draw() may be reading them.
+   */
+  void setPinValFromISR(uint32_t i, uint32_t val);
+
+  // The reading of pin i last stored by setPinValFromISR()
+  uint32_t pinValFromISR(uint32_t i) const { return m_pendingPinVals[i]; }
+
+  /* Takes in what ISRs have changed since the last frame. The main loop calls
+   * it with interrupts masked, then draws with them enabled, so draw() works
+   * from a snapshot that no ISR writes to.
+   */
+  virtual void latch();
+
+  /* Has draw() compose the node's frames through renderer, keeping the last
+   * frame shown on each display in lists, which holds one list per display.
+   * Both may be shared by nodes that are never on screen together, since a
+   * newly shown node is invalidated anyway.
+   */
+  void setRenderer(ILI9341_t3_BandRenderer* renderer, DisplayList* lists);
+
+  static constexpr uint32_t k_numDisplays = 2;
   static constexpr uint32_t k_maxNumPins = 10;
   static constexpr uint32_t k_maxNodeNameChars = 20;
 
@@ -42,6 +79,30 @@ class Node {
   uint32_t childIndex = 0;
   Node* parent = nullptr;
   uint32_t pins[k_maxNumPins] = {};
-  uint32_t pinVals[k_maxNumPins] = {};
+  uint32_t pinVals[k_maxNumPins] = {};  // as of the last latch()
   uint32_t numPins = 0;
+  DirtyRegion dirty[k_numDisplays];
+
+ protected:
+  /* Adds what display i shows to renderer's display list, which starts out
+   * empty. Nothing else has to be tracked: whatever differs from the last
+   * frame's list is repainted. Returns false if the list ran out of room for
+   * something.
+   */
+  virtual bool record(Display& display, uint32_t i,
+                      ILI9341_t3_BandRenderer& renderer);
+
+  /* Records display i's frame and repaints what changed, along with its dirty
+   * region, apart from the area of except. If record() fails, nothing is
+   * drawn, dirty[i] is marked fully dirty for another way of drawing the
+   * frame and false is returned.
+   */
+  bool drawRecorded(Display& display, uint32_t i, const Rect& except = Rect());
+
+  ILI9341_t3_BandRenderer* m_renderer = nullptr;
+  DisplayList* m_displayLists = nullptr;
+
+ private:
+  std::atomic<bool> m_invalidatePending{false};
+  std::atomic<uint32_t> m_pendingPinVals[k_maxNumPins] = {};
 };
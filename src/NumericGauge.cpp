@@ -0,0 +1,101 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "NumericGauge.h"
+
+NumericGauge::NumericGauge(int16_t x, int16_t y, uint32_t numDigits,
+                           const ILI9341_t3_font_t& font, uint16_t color,
+                           uint16_t bgColor, char placeholder)
+    : m_x(x),
+      m_y(y),
+      m_numDigits(numDigits < k_maxDigits ? numDigits : k_maxDigits),
+      m_font(&font),
+      m_color(color),
+      m_bgColor(bgColor),
+      m_placeholder(placeholder) {
+  for (uint32_t i = 0; i < m_numDigits; i++) {
+    m_digits[i] = m_placeholder;
+  }
+}
+
+void NumericGauge::setValue(uint32_t value) {
+  // Fill the cells from the right, blanking leading zeros
+  for (uint32_t i = m_numDigits; i > 0; i--) {
+    if (value == 0 && i < m_numDigits) {
+      m_digits[i - 1] = ' ';
+    } else {
+      m_digits[i - 1] = '0' + value % 10;
+    }
+    value /= 10;
+  }
+
+  if (value > 0) {
+    for (uint32_t i = 0; i < m_numDigits; i++) {
+      m_digits[i] = '9';
+    }
+  }
+}
+
+void NumericGauge::invalidate() {
+  for (uint32_t i = 0; i < m_numDigits; i++) {
+    m_shown[i] = '\0';
+  }
+}
+
+void NumericGauge::draw(ILI9341_t3& display) {
+  display.setFont(*m_font);
+  int16_t width = cellWidth(display);
+  display.setTextColor(m_color, m_bgColor);
+
+  if (m_tearFree) {
+    Rect changed;
+    for (uint32_t i = 0; i < m_numDigits; i++) {
+      if (m_digits[i] != m_shown[i]) {
+        changed = changed.united(Rect(m_x + i * width, m_y, width,
+                                      m_cellHeight));
+      }
+    }
+    if (!changed.isEmpty()) {
+      display.waitForScanout(changed.x, changed.y, changed.w, changed.h);
+    }
+  }
+
+  for (uint32_t i = 0; i < m_numDigits; i++) {
+    if (m_digits[i] == m_shown[i]) {
+      continue;
+    }
+
+    // Center the digit in its cell, then paint the whole cell with it
+    char str[2] = {m_digits[i], '\0'};
+    uint16_t advance;
+    uint16_t lineHeight;
+    display.measureChar(m_digits[i], &advance, &lineHeight);
+    int16_t cellX = m_x + i * width;
+    display.setCursor(cellX + (width - advance) / 2, m_y);
+    display.drawText(str, cellX, m_y, width, m_cellHeight);
+
+    m_shown[i] = m_digits[i];
+  }
+}
+
+Rect NumericGauge::bounds(ILI9341_t3& display) {
+  display.setFont(*m_font);
+  int16_t width = cellWidth(display);
+  return Rect(m_x, m_y, width * m_numDigits, m_cellHeight);
+}
+
+int16_t NumericGauge::cellWidth(ILI9341_t3& display) {
+  if (m_cellWidth == 0) {
+    uint16_t advance;
+    uint16_t lineHeight;
+    display.measureChar(m_placeholder, &advance, &lineHeight);
+    m_cellWidth = advance;
+    m_cellHeight = lineHeight;
+    for (char c = '0'; c <= '9'; c++) {
+      display.measureChar(c, &advance, &lineHeight);
+      if (advance > m_cellWidth) {
+        m_cellWidth = advance;
+      }
+    }
+  }
+  return m_cellWidth;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "DirtyRegion.h"
+#include "libs/ILI9341_t3.h"
+
+/* Shows a number right-aligned in a row of equal-width digit cells and
+ * remembers what each cell last showed, so a new value repaints only the
+ * cells whose digit changed. Each cell is painted opaquely, text color on the
+ * background color, so nothing has to be cleared beneath it first. Until a
+ * value is set, every cell shows the placeholder.
+ */
+class NumericGauge {
+ public:
+  static constexpr uint32_t k_maxDigits = 5;
+
+  NumericGauge(int16_t x, int16_t y, uint32_t numDigits,
+               const ILI9341_t3_font_t& font, uint16_t color, uint16_t bgColor,
+               char placeholder = '-');
+
+  // Values too wide for the cells show as all nines
+  void setValue(uint32_t value);
+
+  // Makes the next draw() repaint every cell, e.g. after something drew over
+  void invalidate();
+
+  /* Makes draw() wait for the panel's refresh to reach a point where the
+   * changed cells can be repainted without the new value showing torn
+   */
+  void setTearFree(bool enable) { m_tearFree = enable; }
+
+  // Repaints the cells whose digit changed since they were last drawn
+  void draw(ILI9341_t3& display);
+
+  // Area the cells cover
+  Rect bounds(ILI9341_t3& display);
+
+ private:
+  // Widest advance among the digits and the placeholder, measured once
+  int16_t cellWidth(ILI9341_t3& display);
+
+  int16_t m_x;
+  int16_t m_y;
+  uint32_t m_numDigits;
+  const ILI9341_t3_font_t* m_font;
+  uint16_t m_color;
+  uint16_t m_bgColor;
+  char m_placeholder;
+  bool m_tearFree = false;
+
+  int16_t m_cellWidth = 0;
+  int16_t m_cellHeight = 0;
+
+  // ' ' is a blank cell; '\0' in m_shown means the cell's contents are unknown
+  char m_digits[k_maxDigits];
+  char m_shown[k_maxDigits] = {};
+};
@@ -0,0 +1,127 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "ScreenCapture.h"
+
+#include <algorithm>
+
+constexpr uint8_t ScreenCapture::k_sync[2];
+
+static uint8_t* putU16(uint8_t* out, uint16_t value) {
+  *out++ = value & 0xFF;
+  *out++ = value >> 8;
+  return out;
+}
+
+void ScreenCapture::start(ILI9341_t3& display, uint8_t panel) {
+  m_display = &display;
+  m_panel = panel;
+  m_frame++;
+  m_width = std::min(static_cast<uint32_t>(display.width()), k_maxWidth);
+  m_height = display.height();
+  m_row = 0;
+  m_rowRead = 0;
+  m_chunkSize = 0;
+  m_chunkSent = 0;
+
+  // Row 0 is encoded against black
+  std::fill(m_above, m_above + m_width, 0);
+}
+
+bool ScreenCapture::busy() const { return m_display != nullptr; }
+
+uint32_t ScreenCapture::service(Print& out, uint32_t budget,
+                                uint32_t readMicros) {
+  if (m_display == nullptr) {
+    return 0;
+  }
+  if (m_chunkSize == 0) {
+    if (m_rowRead == 0 && m_row > 0) {
+      std::swap(m_above, m_current);
+    }
+
+    // Each pixel is read back as 24 bits
+    uint32_t pixels = static_cast<uint64_t>(readMicros) * ILI9341_READCLOCK /
+                      24 / 1000000;
+    uint32_t left = m_width - m_rowRead;
+    pixels = std::min(std::max(pixels, 1u), left);
+    m_display->readRect(m_rowRead, m_row, pixels, 1, m_current + m_rowRead);
+    m_rowRead += pixels;
+    if (m_rowRead < m_width) {
+      return 0;
+    }
+    encodeRow();
+  }
+
+  uint32_t count = std::min(budget, m_chunkSize - m_chunkSent);
+  if (count > 0) {
+    out.write(m_chunk + m_chunkSent, count);
+    m_chunkSent += count;
+  }
+
+  if (m_chunkSent == m_chunkSize) {
+    m_chunkSize = 0;
+    m_chunkSent = 0;
+    m_rowRead = 0;
+    m_row++;
+    if (m_row == m_height) {
+      m_display = nullptr;
+    }
+  }
+  return count;
+}
+
+void ScreenCapture::encodeRow() {
+  uint8_t* out = m_chunk + k_headerSize;
+  uint8_t* literalTag = nullptr;
+  uint32_t x = 0;
+  while (x < m_width) {
+    uint32_t copy = 0;
+    while (x + copy < m_width && copy < 64 &&
+           m_current[x + copy] == m_above[x + copy]) {
+      copy++;
+    }
+    uint32_t repeat = 1;
+    while (x + repeat < m_width && repeat < 64 &&
+           m_current[x + repeat] == m_current[x]) {
+      repeat++;
+    }
+
+    // A copy costs only its tag, so it wins ties
+    if (copy > 0 && copy >= repeat) {
+      *out++ = copy - 1;
+      x += copy;
+      literalTag = nullptr;
+    } else if (repeat > 1) {
+      *out++ = 0x40 + repeat - 1;
+      out = putU16(out, m_current[x]);
+      x += repeat;
+      literalTag = nullptr;
+    } else {
+      if (literalTag == nullptr || *literalTag == 0xFF) {
+        literalTag = out++;
+        *literalTag = 0x7F;
+      }
+      (*literalTag)++;
+      out = putU16(out, m_current[x]);
+      x++;
+    }
+  }
+
+  uint16_t length = out - (m_chunk + k_headerSize);
+  uint8_t* header = m_chunk;
+  *header++ = k_sync[0];
+  *header++ = k_sync[1];
+  *header++ = m_panel;
+  *header++ = m_frame;
+  header = putU16(header, m_row);
+  header = putU16(header, m_width);
+  header = putU16(header, m_height);
+  putU16(header, length);
+
+  uint8_t checksum = 0;
+  for (uint8_t* p = m_chunk + 2; p < out; p++) {
+    checksum += *p;
+  }
+  *out++ = checksum;
+  m_chunkSize = out - m_chunk;
+}
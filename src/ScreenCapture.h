@@ -0,0 +1,76 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "libs/ILI9341_t3.h"
+
+/* Streams a display's contents out of a Print, such as Serial, a row at a
+ * time, so frames can be captured while the car runs. Each service() call
+ * reads back only as much of a row from the panel as fits its time budget, and
+ * writes no more than the byte budget it's given, so it never waits on the
+ * output. A frame is read from
+ * panel memory over the many calls it takes to send, so it may mix rows from
+ * before and after a redraw, and hardware scrolling isn't undone.
+ *
+ * Every row goes out as one chunk, little-endian:
+ *
+ *   0xFC 0x51             sync, for finding chunks among other serial output
+ *   panel, frame          u8 each; frame counts captures, wrapping at 256
+ *   row, width, height    u16 each
+ *   length                u16, payload bytes
+ *   payload               the row, encoded as below
+ *   checksum              u8, sum of every byte from panel to payload's end
+ *
+ * The payload is a series of runs, each starting with a tag byte:
+ *
+ *   0x00-0x3F  the next tag + 1 pixels repeat the row above (black for row 0)
+ *   0x40-0x7F  one RGB565 color follows, repeated tag - 0x40 + 1 times
+ *   0x80-0xFF  tag - 0x80 + 1 RGB565 pixels follow as they are
+ *
+ * tools/CaptureDecode.cpp turns a recording of the stream into PNG images.
+ */
+class ScreenCapture {
+ public:
+  static constexpr uint8_t k_sync[2] = {0xFC, 0x51};
+  static constexpr uint32_t k_headerSize = 12;
+  static constexpr uint32_t k_maxWidth = ILI9341_TFTHEIGHT;
+
+  // A row of unrelated pixels, sent as literals, is the largest a chunk gets
+  static constexpr uint32_t k_maxChunkSize =
+      k_headerSize + (k_maxWidth + 127) / 128 + 2 * k_maxWidth + 1;
+
+  // Starts capturing a new frame of display, abandoning any unfinished one
+  void start(ILI9341_t3& display, uint8_t panel);
+
+  // True until the last row of the current frame has been written
+  bool busy() const;
+
+  /* Once the last row has gone out, reads back as many of the next row's
+   * pixels as take readMicros (at least one), and encodes the row when it's
+   * all been read. Then writes up to budget bytes of its chunk. Returns the
+   * bytes written.
+   */
+  uint32_t service(Print& out, uint32_t budget, uint32_t readMicros);
+
+ private:
+  void encodeRow();
+
+  ILI9341_t3* m_display = nullptr;
+  uint8_t m_panel = 0;
+  uint8_t m_frame = 0;
+  uint16_t m_width = 0;
+  uint16_t m_height = 0;
+  uint16_t m_row = 0;
+  uint16_t m_rowRead = 0;  // pixels of m_row read back so far
+
+  uint16_t m_rows[2][k_maxWidth];
+  uint16_t* m_above = m_rows[0];
+  uint16_t* m_current = m_rows[1];
+
+  // The encoded row going out, of which m_chunkSent bytes have been written
+  uint8_t m_chunk[k_maxChunkSize];
+  uint32_t m_chunkSize = 0;
+  uint32_t m_chunkSent = 0;
+};
@@ -6,4 +6,5 @@
 
 Teensy::Teensy(std::unique_ptr<Node> headNode) {
   this->headNode = std::move(headNode);
+  currentNode = this->headNode.get();
 }
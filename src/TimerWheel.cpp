@@ -0,0 +1,108 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel() {
+  for (auto& level : m_slots) {
+    for (auto& slot : level) {
+      slot.m_prev = &slot;
+      slot.m_next = &slot;
+    }
+  }
+}
+
+void TimerWheel::arm(Timer& timer, uint32_t delay, uint32_t period) {
+  cancel(timer);
+  if (delay == 0) {
+    delay = 1;
+  } else if (delay > k_maxDelay) {
+    delay = k_maxDelay;
+  }
+  if (period > k_maxDelay) {
+    period = k_maxDelay;
+  }
+  timer.m_expires = m_now + delay;
+  timer.m_period = period;
+  place(timer);
+}
+
+void TimerWheel::cancel(Timer& timer) {
+  if (!timer.armed()) {
+    return;
+  }
+  timer.m_prev->m_next = timer.m_next;
+  timer.m_next->m_prev = timer.m_prev;
+  timer.m_prev = nullptr;
+  timer.m_next = nullptr;
+}
+
+void TimerWheel::tick() {
+  m_now++;
+
+  // Refill the levels below from the coarser ones, coarsest first, as the
+  // tick count crosses into each of their slots
+  uint32_t level = 0;
+  while (level + 1 < k_levels &&
+         (m_now & ((1 << (k_slotBits * (level + 1))) - 1)) == 0) {
+    level++;
+  }
+  for (; level > 0; level--) {
+    cascade(level);
+  }
+
+  // Run what's due, on a list of its own so callbacks can arm or cancel any
+  // timer, including ones still waiting to run here
+  Timer due;
+  due.m_prev = &due;
+  due.m_next = &due;
+  takeAll(m_slots[0][m_now % k_slots], due);
+  while (due.m_next != &due) {
+    Timer& timer = *due.m_next;
+    cancel(timer);
+    if (timer.m_period > 0) {
+      timer.m_expires += timer.m_period;
+      place(timer);
+    }
+    timer.m_callback();
+  }
+}
+
+void TimerWheel::place(Timer& timer) {
+  // Find the finest level whose slots reach the expiry from here
+  uint32_t delay = timer.m_expires - m_now;
+  uint32_t level = 0;
+  while (level + 1 < k_levels && delay >> (k_slotBits * (level + 1)) != 0) {
+    level++;
+  }
+
+  Timer& slot =
+      m_slots[level][(timer.m_expires >> (k_slotBits * level)) % k_slots];
+  timer.m_prev = slot.m_prev;
+  timer.m_next = &slot;
+  slot.m_prev->m_next = &timer;
+  slot.m_prev = &timer;
+}
+
+void TimerWheel::takeAll(Timer& slot, Timer& list) {
+  if (slot.m_next == &slot) {
+    return;
+  }
+  slot.m_next->m_prev = list.m_prev;
+  list.m_prev->m_next = slot.m_next;
+  slot.m_prev->m_next = &list;
+  list.m_prev = slot.m_prev;
+  slot.m_prev = &slot;
+  slot.m_next = &slot;
+}
+
+void TimerWheel::cascade(uint32_t level) {
+  Timer moving;
+  moving.m_prev = &moving;
+  moving.m_next = &moving;
+  takeAll(m_slots[level][(m_now >> (k_slotBits * level)) % k_slots], moving);
+  while (moving.m_next != &moving) {
+    Timer& timer = *moving.m_next;
+    cancel(timer);
+    place(timer);
+  }
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+class TimerWheel;
+
+/* A callback for TimerWheel to run after some number of ticks, once or
+ * periodically. It holds its own links into the wheel, so arming one never
+ * allocates.
+ */
+class Timer {
+ public:
+  explicit Timer(void (*callback)(void) = nullptr) : m_callback(callback) {}
+
+  bool armed() const { return m_next != nullptr; }
+
+ private:
+  friend class TimerWheel;
+
+  void (*m_callback)(void);
+  uint32_t m_expires = 0;  // tick it's due on
+  uint32_t m_period = 0;   // ticks between runs, or 0 to run once
+
+  // Neighbors in the wheel slot's circular list, or null when not armed
+  Timer* m_prev = nullptr;
+  Timer* m_next = nullptr;
+};
+
+/* Runs any number of software timers from one periodic tick, such as a single
+ * PIT interrupt. Timers due within k_slots ticks sit in the first level's slot
+ * for their tick; later ones sit in coarser levels, where each slot spans
+ * k_slots times as many ticks as one below, and are moved down a level as the
+ * tick count reaches their slot. Arming, re-arming and canceling are O(1).
+ *
+ * tick() runs the due callbacks in whatever context calls it. Timers may be
+ * armed or canceled from those callbacks; from anywhere else, mask the
+ * interrupt that calls tick() around it.
+ */
+class TimerWheel {
+ public:
+  static constexpr uint32_t k_slotBits = 6;
+  static constexpr uint32_t k_slots = 1 << k_slotBits;
+  static constexpr uint32_t k_levels = 3;
+
+  // Longest delay a timer can be armed with, in ticks
+  static constexpr uint32_t k_maxDelay = (1 << (k_slotBits * k_levels)) - 1;
+
+  TimerWheel();
+
+  /* Has timer run delay ticks from now, and every period ticks after that if
+   * period isn't 0. A timer already armed is moved. Delays are clamped to
+   * between 1 and k_maxDelay, and periods to k_maxDelay.
+   */
+  void arm(Timer& timer, uint32_t delay, uint32_t period = 0);
+
+  // Stops timer from running, if it's armed
+  void cancel(Timer& timer);
+
+  // Advances one tick and runs the timers that came due
+  void tick();
+
+ private:
+  // Links timer into the slot its expiry falls in, as seen from m_now
+  void place(Timer& timer);
+
+  // Moves every timer in a slot onto the end of list, emptying the slot
+  static void takeAll(Timer& slot, Timer& list);
+
+  // Moves the timers in level's slot for the current tick down the wheel
+  void cascade(uint32_t level);
+
+  uint32_t m_now = 0;
+
+  // Each slot is the sentinel of a circular list of the timers in it
+  Timer m_slots[k_levels][k_slots];
+};
@@ -0,0 +1,31 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#include "VerticalDebouncer.h"
+
+VerticalDebouncer::VerticalDebouncer(uint32_t holdSamples)
+    : m_holdSamples(holdSamples) {}
+
+void VerticalDebouncer::update(uint32_t sample) {
+  // Count up where the sample differs from the state, and clear elsewhere. A
+  // counter wrapping back to zero marks an input whose change has lasted.
+  uint32_t delta = sample ^ m_state;
+  m_count1 = (m_count1 ^ m_count0) & delta;
+  m_count0 = ~m_count0 & delta;
+  m_changed = delta & ~(m_count0 | m_count1);
+  m_state ^= m_changed;
+
+  // Only active inputs need their hold time tracked
+  m_held = 0;
+  for (uint32_t active = m_state, bit = 0; active != 0; active >>= 1, bit++) {
+    if ((active & 1) == 0) {
+      continue;
+    }
+    if (m_changed & (1u << bit)) {
+      m_activeSamples[bit] = 0;
+    }
+    if (m_activeSamples[bit] < m_holdSamples &&
+        ++m_activeSamples[bit] == m_holdSamples) {
+      m_held |= 1u << bit;
+    }
+  }
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+#pragma once
+
+#include <stdint.h>
+
+/* Debounces up to 32 inputs at once, one per bit of a sample, so a whole GPIO
+ * port can be read and debounced in one go. Bit n of m_count0 and m_count1
+ * together form a two-bit counter of how many samples in a row input n has
+ * differed from its debounced state; the fourth flips it, and any sample that
+ * agrees resets the count. Each update() is a handful of bitwise operations
+ * however many inputs there are.
+ */
+class VerticalDebouncer {
+ public:
+  /* An input that stays active for holdSamples samples in a row is reported
+   * held, once per press
+   */
+  explicit VerticalDebouncer(uint32_t holdSamples);
+
+  // Takes a sample, with the bits of active inputs set
+  void update(uint32_t sample);
+
+  // Inputs currently active, after debouncing
+  uint32_t state() const { return m_state; }
+
+  // Inputs that became active, became inactive, or were first reported held
+  // on the last update()
+  uint32_t pressed() const { return m_changed & m_state; }
+  uint32_t released() const { return m_changed & ~m_state; }
+  uint32_t held() const { return m_held; }
+
+ private:
+  uint32_t m_holdSamples;
+  uint32_t m_state = 0;
+  uint32_t m_count0 = 0;
+  uint32_t m_count1 = 0;
+  uint32_t m_changed = 0;
+  uint32_t m_held = 0;
+
+  // Samples each active input has been active for, up to m_holdSamples
+  uint16_t m_activeSamples[32] = {};
+};
@@ -17,14 +17,14 @@
  ****************************************************/
 
 #include "ILI9341_t3.h"
+#ifndef ILI9341_T3_EMULATOR
 #include "SPI.h"
+#include <DMAChannel.h>
+#endif
 #include <algorithm>
 #include <cmath>
 
-// Teensy 3.1 can only generate 30 MHz SPI when running at 120 MHz (overclock)
-// At all other speeds, SPI.beginTransaction() will use the fastest available
-// clock
-#define SPICLOCK 30000000
+#define SPICLOCK ILI9341_SPICLOCK
 
 #define WIDTH ILI9341_TFTWIDTH
 #define HEIGHT ILI9341_TFTHEIGHT
@@ -44,23 +44,52 @@ ILI9341_t3::ILI9341_t3(uint8_t cs, uint8_t dc, uint8_t rst, uint8_t mosi,
   rotation = 0;
   cursor_y = cursor_x = 0;
   textsize = 1;
-  textcolor = textbgcolor = 0xFFFF;
+  setTextColor(0xFFFF);
   wrap = true;
   font = nullptr;
+  utf8pending = 0;
+  glyphcache = nullptr;
+  maxtransaction = ILI9341_MAX_TRANSACTION;
+  lineperiod = 24 * 1000000000ULL / ILI9341_FOSC;  // as init sets FRMCTR1
+  _te = 255;
+  resetmillis = sleepoutmillis = 0;
+  pcs_data = pcs_command = 0;
+  solo_pcs_data = solo_pcs_command = 0;
+  broadcast = nullptr;
+}
+
+// State of the one asynchronous transfer SPI0 can carry at a time
+static ILI9341_t3* volatile asyncDisplay = nullptr;
+static void (*asyncCallback)(void) = nullptr;
+
+#ifdef ILI9341_T3_EMULATOR
+void ILI9341_t3::beginSPITransaction(uint32_t clock) {
+  waitAsync();
+  panel.beginTransaction();
 }
 
+void ILI9341_t3::endSPITransaction(void) { panel.endTransaction(); }
+#else
+void ILI9341_t3::beginSPITransaction(uint32_t clock) {
+  waitAsync();
+  SPI.beginTransaction(SPISettings(clock, MSBFIRST, SPI_MODE0));
+}
+
+void ILI9341_t3::endSPITransaction(void) { SPI.endTransaction(); }
+#endif
+
 void ILI9341_t3::setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1,
                                uint16_t y1) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   setAddr(x0, y0, x1, y1);
   writecommand_last(ILI9341_RAMWR);  // write to RAM
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::pushColor(uint16_t color) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   writedata16_last(color);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::drawPixel(int16_t x, int16_t y, uint16_t color) {
@@ -68,11 +97,11 @@ void ILI9341_t3::drawPixel(int16_t x, int16_t y, uint16_t color) {
     return;
   }
 
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   setAddr(x, y, x, y);
   writecommand_cont(ILI9341_RAMWR);
   writedata16_last(color);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::drawFastVLine(int16_t x, int16_t y, int16_t h,
@@ -84,14 +113,15 @@ void ILI9341_t3::drawFastVLine(int16_t x, int16_t y, int16_t h,
   if ((y + h - 1) >= _height) {
     h = _height - y;
   }
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   setAddr(x, y, x, y + h - 1);
   writecommand_cont(ILI9341_RAMWR);
+  uint32_t sent = 0;
   while (h-- > 1) {
-    writedata16_cont(color);
+    writedata16_bounded(color, sent);
   }
   writedata16_last(color);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::drawFastHLine(int16_t x, int16_t y, int16_t w,
@@ -103,14 +133,15 @@ void ILI9341_t3::drawFastHLine(int16_t x, int16_t y, int16_t w,
   if ((x + w - 1) >= _width) {
     w = _width - x;
   }
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   setAddr(x, y, x + w - 1, y);
   writecommand_cont(ILI9341_RAMWR);
+  uint32_t sent = 0;
   while (w-- > 1) {
-    writedata16_cont(color);
+    writedata16_bounded(color, sent);
   }
   writedata16_last(color);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::fillScreen(uint16_t color) {
@@ -131,23 +162,27 @@ void ILI9341_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
     h = _height - y;
   }
 
-  // TODO: this can result in a very long transaction time
-  // should break this into multiple transactions, even though
-  // it'll cost more overhead, so we don't stall other SPI libs
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  // Long fills are split into several transactions, per setMaxTransaction(),
+  // so we don't stall other SPI libs
+  beginSPITransaction();
   setAddr(x, y, x + w - 1, y + h - 1);
   writecommand_cont(ILI9341_RAMWR);
-  for (y = h; y > 0; y--) {
-    for (x = w; x > 1; x--) {
-      writedata16_cont(color);
-    }
-    writedata16_last(color);
-    if (y > 1 && (y & 1)) {
-      SPI.endTransaction();
-      SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
-    }
+  uint32_t sent = 0;
+  for (uint32_t count = w * h; count > 1; count--) {
+    writedata16_bounded(color, sent);
   }
-  SPI.endTransaction();
+  writedata16_last(color);
+  endSPITransaction();
+}
+
+void ILI9341_t3::setMaxTransactionMicros(uint32_t us) {
+  // 16 bits per pixel on the wire
+  uint64_t pixels = (uint64_t)us * SPICLOCK / 16 / 1000000;
+  maxtransaction = pixels > 0 ? pixels : 1;
 }
 
 #define MADCTL_MY 0x80
@@ -160,7 +195,7 @@ void ILI9341_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 
 void ILI9341_t3::setRotation(uint8_t m) {
   rotation = m % 4;  // can't be higher than 3
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   writecommand_cont(ILI9341_MADCTL);
   switch (rotation) {
     case 0:
@@ -184,22 +219,172 @@ void ILI9341_t3::setRotation(uint8_t m) {
       _height = ILI9341_TFTWIDTH;
       break;
   }
-  SPI.endTransaction();
+  endSPITransaction();
   cursor_x = 0;
   cursor_y = 0;
+
+  // The other panel received the same MADCTL
+  if (broadcast != nullptr) {
+    broadcast->rotation = rotation;
+    broadcast->_width = _width;
+    broadcast->_height = _height;
+    broadcast->cursor_x = 0;
+    broadcast->cursor_y = 0;
+  }
+}
+
+void ILI9341_t3::setScrollArea(uint16_t top, uint16_t height) {
+  beginSPITransaction();
+  writecommand_cont(ILI9341_VSCRDEF);
+  writedata16_cont(top);                               // TFA
+  writedata16_cont(height);                            // VSA
+  writedata16_last(ILI9341_TFTHEIGHT - top - height);  // BFA
+  endSPITransaction();
 }
 
 void ILI9341_t3::setScroll(uint16_t offset) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   writecommand_cont(ILI9341_VSCRSADD);
   writedata16_last(offset);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 void ILI9341_t3::invertDisplay(boolean i) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   writecommand_last(i ? ILI9341_INVON : ILI9341_INVOFF);
-  SPI.endTransaction();
+  endSPITransaction();
+}
+
+uint32_t ILI9341_t3::setFrameRate(uint32_t hz) {
+  // A line takes RTNA (16 to 31) clocks of the oscillator divided by
+  // 2^DIVA; pick the pair whose frame rate is nearest
+  uint32_t bestDiva = 0, bestRtna = 0x18, bestHz = 0;
+  for (uint32_t diva = 0; diva < 4; diva++) {
+    for (uint32_t rtna = 16; rtna < 32; rtna++) {
+      uint32_t rate = ILI9341_FOSC / ((rtna << diva) * ILI9341_SCANLINES);
+      uint32_t error = rate > hz ? rate - hz : hz - rate;
+      uint32_t bestError = bestHz > hz ? bestHz - hz : hz - bestHz;
+      if (bestHz == 0 || error < bestError) {
+        bestDiva = diva;
+        bestRtna = rtna;
+        bestHz = rate;
+      }
+    }
+  }
+
+  beginSPITransaction();
+  writecommand_cont(ILI9341_FRMCTR1);
+  writedata8_cont(bestDiva);
+  writedata8_last(bestRtna);
+  endSPITransaction();
+  lineperiod = (uint64_t)(bestRtna << bestDiva) * 1000000000 / ILI9341_FOSC;
+  return bestHz;
+}
+
+void ILI9341_t3::setTearingPin(uint8_t pin) {
+  pinMode(pin, INPUT);
+  _te = pin;
+  beginSPITransaction();
+  writecommand_cont(ILI9341_TEON);
+  writedata8_last(0x00);  // V-blanking only
+  endSPITransaction();
+}
+
+// Refresh that first shows a line of GRAM written at time t, in ns from the
+// start of refresh 0; the beam reaches the line at line * lineperiod
+static int32_t refreshShowing(int32_t t, int32_t line, int32_t lineperiod) {
+  int32_t since = t - line * lineperiod;
+  int32_t frame = lineperiod * ILI9341_SCANLINES;
+  return since <= 0 ? 0 : (since + frame - 1) / frame;
+}
+
+// Whether writing lines [first, first + lines) from start to start + total
+// shows all of them first in one refresh. A progressive write covers the
+// lines one after another, in reverse if asked; otherwise each is written
+// from the start to the end.
+static bool showsWhole(int32_t start, int32_t total, int32_t first,
+                       int32_t lines, bool progressive, bool reverse,
+                       int32_t lineperiod) {
+  int32_t shown = 0;
+  for (int32_t i = 0; i < lines; i++) {
+    int32_t begin = start;
+    int32_t end = start + total;
+    if (progressive) {
+      begin = start + (int64_t)total * i / lines;
+      end = start + (int64_t)total * (i + 1) / lines;
+    }
+    int32_t line = reverse ? first + lines - 1 - i : first + i;
+    int32_t a = refreshShowing(begin, line, lineperiod);
+    if (a != refreshShowing(end, line, lineperiod) || (i > 0 && a != shown)) {
+      return false;
+    }
+    shown = a;
+  }
+  return true;
+}
+
+void ILI9341_t3::waitForScanout(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int32_t x0 = x < 0 ? 0 : x;
+  int32_t y0 = y < 0 ? 0 : y;
+  int32_t x1 = x + w > _width ? _width : x + w;
+  int32_t y1 = y + h > _height ? _height : y + h;
+  if (x1 <= x0 || y1 <= y0) {
+    return;
+  }
+
+  // The panel lines the area covers. Each row written is one of them in
+  // portrait, running bottom to top when rotated 180; in landscape, each row
+  // written crosses them all.
+  bool portrait = (rotation & 1) == 0;
+  int32_t first, lines;
+  if (portrait) {
+    first = rotation == 0 ? y0 : HEIGHT - y1;
+    lines = y1 - y0;
+  } else {
+    first = rotation == 1 ? x0 : HEIGHT - x1;
+    lines = x1 - x0;
+  }
+  int32_t total = (uint64_t)(x1 - x0) * (y1 - y0) * 16 * 1000000000 / SPICLOCK;
+  int32_t period = lineperiod;
+
+  // Where the beam is, in ns from the start of this refresh
+  int32_t now;
+#ifndef ILI9341_T3_EMULATOR
+  if (_te != 255) {
+    while (digitalReadFast(_te)) {
+    }
+    while (!digitalReadFast(_te)) {
+    }
+    now = HEIGHT * period;
+  } else
+#endif
+  {
+    now = readScanline() * period;
+  }
+
+  // Start right away, just behind the beam as it passes the area's first
+  // line, or just after it leaves the last, whichever is soonest to work.
+  // The scanline is read to the line, so check the line's end as well.
+  int32_t line = now / period;
+  int32_t behind = (first - line + ILI9341_SCANLINES) % ILI9341_SCANLINES + 1;
+  int32_t after =
+      (first + lines - 1 - line + ILI9341_SCANLINES) % ILI9341_SCANLINES + 1;
+  int32_t delays[3] = {0, behind < after ? behind : after,
+                       behind < after ? after : behind};
+  int32_t wait = (portrait ? behind : after) * period;
+  for (uint32_t i = 0; i < 3; i++) {
+    int32_t start = now + delays[i] * period;
+    if (showsWhole(start, total, first, lines, portrait, rotation == 2,
+                   period) &&
+        showsWhole(start + period - 1, total, first, lines, portrait,
+                   rotation == 2, period)) {
+      wait = delays[i] * period;
+      break;
+    }
+  }
+  if (wait > 0) {
+    delayMicroseconds(wait / 1000);
+  }
 }
 
 /*
@@ -229,11 +414,26 @@ until empty
 }
 */
 
+uint16_t ILI9341_t3::readScanline(void) {
+  // GTS[9:8] come first, then GTS[7:0]
+  uint16_t high = readcommand8(ILI9341_GSCAN, 0);
+  return (high & 0x03) << 8 | readcommand8(ILI9341_GSCAN, 1);
+}
+
 uint8_t ILI9341_t3::readcommand8(uint8_t c, uint8_t index) {
+#ifdef ILI9341_T3_EMULATOR
+  beginSPITransaction();
+  writecommand_cont(0xD9);  // sekret command
+  writedata8_cont(0x10 + index);
+  writecommand_cont(c);
+  uint8_t r = panel.readRegister(c, index);
+  endSPITransaction();
+  return r;
+#else
   uint16_t wTimeout = 0xffff;
   uint8_t r = 0;
 
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   while (((KINETISK_SPI0.SR) & (15 << 12)) &&
          (--wTimeout)) {  // wait until empty
   }
@@ -287,16 +487,22 @@ uint8_t ILI9341_t3::readcommand8(uint8_t c, uint8_t index) {
   while ((((KINETISK_SPI0.SR) >> 4) & 0xf) && (--wTimeout)) {
     r = KINETISK_SPI0.POPR;
   }
-  SPI.endTransaction();
+  endSPITransaction();
   return r;  // get the received byte... should check for it first...
+#endif
 }
 
 // Read Pixel at x,y and get back 16-bit packed color
 uint16_t ILI9341_t3::readPixel(int16_t x, int16_t y) {
+#ifdef ILI9341_T3_EMULATOR
+  uint16_t color;
+  readRect(x, y, 1, 1, &color);
+  return color;
+#else
   uint8_t dummy __attribute__((unused));
   uint8_t r, g, b;
 
-  SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+  beginSPITransaction(ILI9341_READCLOCK);
 
   setAddr(x, y, x, y);
   writecommand_cont(ILI9341_RAMRD);  // read from RAM
@@ -325,18 +531,26 @@ uint16_t ILI9341_t3::readPixel(int16_t x, int16_t y) {
   g = KINETISK_SPI0.POPR;      // Read a GREEN byte of GRAM
   b = KINETISK_SPI0.POPR;      // Read a BLUE byte of GRAM
 
-  SPI.endTransaction();
+  endSPITransaction();
   return color565(r, g, b);
+#endif
 }
 
 // Now lets see if we can read in multiple pixels
 void ILI9341_t3::readRect(int16_t x, int16_t y, int16_t w, int16_t h,
                           uint16_t* pcolors) {
+#ifdef ILI9341_T3_EMULATOR
+  beginSPITransaction(ILI9341_READCLOCK);
+  setAddr(x, y, x + w - 1, y + h - 1);
+  writecommand_cont(ILI9341_RAMRD);  // read from RAM
+  panel.readRect(x, y, w, h, pcolors);
+  endSPITransaction();
+#else
   uint8_t dummy __attribute__((unused));
   uint8_t r, g, b;
   uint16_t c = w * h;
 
-  SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+  beginSPITransaction(ILI9341_READCLOCK);
 
   setAddr(x, y, x + w - 1, y + h - 1);
   writecommand_cont(ILI9341_RAMRD);  // read from RAM
@@ -378,22 +592,167 @@ void ILI9341_t3::readRect(int16_t x, int16_t y, int16_t w, int16_t h,
     while ((KINETISK_SPI0.SR & (15 << 12)) > (3 << 12)) {
     }
   }
-  SPI.endTransaction();
+  endSPITransaction();
+#endif
 }
 
 // Now lets see if we can writemultiple pixels
 void ILI9341_t3::writeRect(int16_t x, int16_t y, int16_t w, int16_t h,
                            const uint16_t* pcolors) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  beginSPITransaction();
   setAddr(x, y, x + w - 1, y + h - 1);
   writecommand_cont(ILI9341_RAMWR);
-  for (y = h; y > 0; y--) {
-    for (x = w; x > 1; x--) {
-      writedata16_cont(*pcolors++);
+  uint32_t sent = 0;
+  for (uint32_t count = w * h; count > 1; count--) {
+    writedata16_bounded(*pcolors++, sent);
+  }
+  writedata16_last(*pcolors);
+  endSPITransaction();
+}
+
+void ILI9341_t3::fillRectAsync(int16_t x, int16_t y, int16_t w, int16_t h,
+                               uint16_t color, void (*callback)(void)) {
+  // rudimentary clipping, same as fillRect()
+  if ((x >= _width) || (y >= _height) || (w <= 0) || (h <= 0)) {
+    return;
+  }
+  if ((x + w - 1) >= _width) {
+    w = _width - x;
+  }
+  if ((y + h - 1) >= _height) {
+    h = _height - y;
+  }
+
+  beginSPITransaction();
+  setAddr(x, y, x + w - 1, y + h - 1);
+  writecommand_cont(ILI9341_RAMWR);
+  startAsync(nullptr, color, w * h, callback);
+}
+
+void ILI9341_t3::writeRectAsync(int16_t x, int16_t y, int16_t w, int16_t h,
+                                const uint16_t* pcolors,
+                                void (*callback)(void)) {
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  beginSPITransaction();
+  setAddr(x, y, x + w - 1, y + h - 1);
+  writecommand_cont(ILI9341_RAMWR);
+  startAsync(pcolors, 0, w * h, callback);
+}
+
+bool ILI9341_t3::asyncBusy(void) { return asyncDisplay != nullptr; }
+
+#ifdef ILI9341_T3_EMULATOR
+void ILI9341_t3::waitAsync(void) {
+  ILI9341_t3* display = asyncDisplay;
+  if (display != nullptr) {
+    display->panel.serviceDma(UINT32_MAX);
+  }
+}
+
+void ILI9341_t3::startAsync(const uint16_t* pcolors, uint16_t color,
+                            uint32_t count, void (*callback)(void)) {
+  asyncDisplay = this;
+  asyncCallback = callback;
+  panel.attachDmaInterrupt(asyncISR);
+  panel.startDma(pcolors, color, count);
+}
+
+void ILI9341_t3::asyncISR(void) { asyncDisplay->finishAsync(); }
+#else
+// The eDMA major loop counter is 15 bits, so long transfers run in chunks
+static constexpr uint32_t k_maxDmaCount = 32767;
+
+static DMAChannel* asyncDma = nullptr;
+static const uint16_t* asyncSource = nullptr;
+static volatile uint16_t asyncColor;
+static uint32_t asyncRemaining = 0;
+
+static void startAsyncChunk(void) {
+  uint32_t count = std::min(asyncRemaining, k_maxDmaCount);
+  if (asyncSource != nullptr) {
+    asyncDma->sourceBuffer(asyncSource, count * 2);
+    asyncSource += count;
+  } else {
+    asyncDma->source(asyncColor);
+    asyncDma->transferCount(count);
+  }
+  asyncRemaining -= count;
+  asyncDma->enable();
+}
+
+void ILI9341_t3::waitAsync(void) {
+  while (asyncDisplay != nullptr) {
+  }
+}
+
+void ILI9341_t3::startAsync(const uint16_t* pcolors, uint16_t color,
+                            uint32_t count, void (*callback)(void)) {
+  // The first pixel goes out as a full PUSHR word so the FIFO latches the
+  // data PCS, CTAS(1) and CONT bits. The DMA then writes only the low half
+  // of PUSHR for the rest, which reuses those command bits.
+  if (pcolors != nullptr) {
+    writedata16_cont(*pcolors++);
+  } else {
+    writedata16_cont(color);
+  }
+  count--;
+  if (count == 0) {
+    writecommand_last(ILI9341_NOP);
+    endSPITransaction();
+    if (callback != nullptr) {
+      callback();
     }
-    writedata16_last(*pcolors++);
+    return;
+  }
+
+  if (asyncDma == nullptr) {
+    asyncDma = new DMAChannel();
+    asyncDma->destination(*(volatile uint16_t*)&KINETISK_SPI0.PUSHR);
+    asyncDma->triggerAtHardwareEvent(DMAMUX_SOURCE_SPI0_TX);
+    asyncDma->interruptAtCompletion();
+    asyncDma->disableOnCompletion();
+    asyncDma->attachInterrupt(asyncISR);
+  }
+
+  asyncCallback = callback;
+  asyncSource = pcolors;
+  asyncColor = color;
+  asyncRemaining = count;
+  asyncDisplay = this;
+
+  startAsyncChunk();
+  SPI0_RSER = SPI_RSER_TFFF_RE | SPI_RSER_TFFF_DIRS;  // request DMA on TX room
+}
+
+void ILI9341_t3::asyncISR(void) {
+  asyncDma->clearInterrupt();
+  if (asyncRemaining > 0) {
+    startAsyncChunk();
+  } else {
+    SPI0_RSER = 0;
+    asyncDisplay->finishAsync();
+  }
+}
+#endif
+
+void ILI9341_t3::finishAsync(void) {
+  // Lets the last queued words clock out before releasing the bus
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
+
+  void (*callback)(void) = asyncCallback;
+  asyncCallback = nullptr;
+  asyncDisplay = nullptr;
+  if (callback != nullptr) {
+    callback();
   }
-  SPI.endTransaction();
 }
 
 static const uint8_t init_commands[] = {4,
@@ -502,6 +861,58 @@ static const uint8_t init_commands[] = {4,
                                         0};
 
 void ILI9341_t3::begin(void) {
+  if (beginPins()) {
+    reset(nullptr);
+    sendInitCommands();
+    displayOn();
+  }
+}
+
+void ILI9341_t3::begin(ILI9341_t3& other) {
+  if (!beginPins() || !other.beginPins()) {
+    return;
+  }
+  reset(&other);
+  setBroadcast(&other);
+  sendInitCommands();
+  setBroadcast(nullptr);
+  other.resetmillis = resetmillis;
+  other.sleepoutmillis = sleepoutmillis;
+}
+
+void ILI9341_t3::displayOn(void) {
+  uint32_t elapsed = millis() - sleepoutmillis;
+  if (elapsed < 120) {
+    delay(120 - elapsed);
+  }
+  beginSPITransaction();
+  writecommand_last(ILI9341_DISPON);  // Display on
+  endSPITransaction();
+}
+
+void ILI9341_t3::setBroadcast(ILI9341_t3* other) {
+  // Words already queued for DMA carry the chip selects they were sent with
+  waitAsync();
+  broadcast = other;
+  pcs_data = solo_pcs_data;
+  pcs_command = solo_pcs_command;
+  if (other != nullptr) {
+    pcs_data |= other->solo_pcs_data;
+    pcs_command |= other->solo_pcs_command;
+  }
+#ifdef ILI9341_T3_EMULATOR
+  panel.setMirror(other != nullptr ? &other->panel : nullptr);
+#endif
+}
+
+// Routes the SPI pins and chip selects. Returns false if the pins can't be
+// used.
+bool ILI9341_t3::beginPins(void) {
+#ifdef ILI9341_T3_EMULATOR
+  // The emulated panel has no pins to route; it is always selected
+  pcs_data = 0;
+  pcs_command = 0;
+#else
   // verify SPI pins are valid;
   if ((_mosi == 11 || _mosi == 7) && (_miso == 12 || _miso == 8) &&
       (_sclk == 13 || _sclk == 14)) {
@@ -509,7 +920,7 @@ void ILI9341_t3::begin(void) {
     SPI.setMISO(_miso);
     SPI.setSCK(_sclk);
   } else {
-    return;  // not valid pins...
+    return false;  // not valid pins...
   }
   SPI.begin();
   if (SPI.pinIsChipSelect(_cs, _dc)) {
@@ -518,18 +929,46 @@ void ILI9341_t3::begin(void) {
   } else {
     pcs_data = 0;
     pcs_command = 0;
+    return false;
+  }
+#endif
+  solo_pcs_data = pcs_data;
+  solo_pcs_command = pcs_command;
+  return true;
+}
+
+// Toggles RST low to reset the panel, and other's along with it. Commands
+// can follow 5 ms later, though SLPOUT has to wait until 120 ms have passed.
+void ILI9341_t3::reset(ILI9341_t3* other) {
+  uint8_t pins[2] = {_rst, other != nullptr ? other->_rst : (uint8_t)255};
+  if (pins[0] == 255 && pins[1] == 255) {
+    resetmillis = millis() - 120;  // nothing to wait for
     return;
   }
-  // toggle RST low to reset
-  if (_rst < 255) {
-    pinMode(_rst, OUTPUT);
-    digitalWrite(_rst, HIGH);
-    delay(5);
-    digitalWrite(_rst, LOW);
-    delay(20);
-    digitalWrite(_rst, HIGH);
-    delay(150);
+
+  for (uint8_t pin : pins) {
+    if (pin < 255) {
+      pinMode(pin, OUTPUT);
+      digitalWrite(pin, HIGH);
+    }
+  }
+  delay(5);
+  for (uint8_t pin : pins) {
+    if (pin < 255) {
+      digitalWrite(pin, LOW);
+    }
+  }
+  delay(20);
+  for (uint8_t pin : pins) {
+    if (pin < 255) {
+      digitalWrite(pin, HIGH);
+    }
   }
+  resetmillis = millis();
+  delay(5);
+}
+
+void ILI9341_t3::sendInitCommands(void) {
   /*
   uint8_t x = readcommand8(ILI9341_RDMODE);
   Serial.print("\nDisplay Power Mode: 0x"); Serial.println(x, HEX);
@@ -542,7 +981,7 @@ void ILI9341_t3::begin(void) {
   x = readcommand8(ILI9341_RDSELFDIAG);
   Serial.print("\nSelf Diagnostic: 0x"); Serial.println(x, HEX);
   */
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   const uint8_t* addr = init_commands;
   while (1) {
     uint8_t count = *addr++;
@@ -554,13 +993,18 @@ void ILI9341_t3::begin(void) {
       writedata8_cont(*addr++);
     }
   }
-  writecommand_last(ILI9341_SLPOUT);  // Exit Sleep
-  SPI.endTransaction();
+  endSPITransaction();
 
-  delay(120);
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
-  writecommand_last(ILI9341_DISPON);  // Display on
-  SPI.endTransaction();
+  // The commands above overlap the wait after reset
+  uint32_t elapsed = millis() - resetmillis;
+  if (elapsed < 120) {
+    delay(120 - elapsed);
+  }
+  beginSPITransaction();
+  writecommand_last(ILI9341_SLPOUT);  // Exit Sleep
+  endSPITransaction();
+  sleepoutmillis = millis();
+  delay(5);
 }
 
 /*
@@ -599,50 +1043,56 @@ POSSIBILITY OF SUCH DAMAGE.
 //#include "glcdfont.c"
 extern "C" const unsigned char glcdfont[];
 
-// Draw a circle outline
-void ILI9341_t3::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
-
-  drawPixel(x0, y0 + r, color);
-  drawPixel(x0, y0 - r, color);
-  drawPixel(x0 + r, y0, color);
-  drawPixel(x0 - r, y0, color);
-
-  while (x < y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
+// Fills a rectangle, clipped to the screen, through one address window in an
+// already open transaction. Shapes send all their spans this way, so they
+// cost one transaction however many spans they're made of.
+void ILI9341_t3::fillSpan(int16_t x, int16_t y, int16_t w, int16_t h,
+                          uint16_t color, uint32_t& sent) {
+  int32_t x0 = std::max((int32_t)x, (int32_t)0);
+  int32_t y0 = std::max((int32_t)y, (int32_t)0);
+  int32_t x1 = std::min((int32_t)x + w, (int32_t)_width);
+  int32_t y1 = std::min((int32_t)y + h, (int32_t)_height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
 
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
+  setAddr(x0, y0, x1 - 1, y1 - 1);
+  writecommand_cont(ILI9341_RAMWR);
+  for (int32_t i = (x1 - x0) * (y1 - y0); i > 0; i--) {
+    writedata16_bounded(color, sent);
   }
 }
 
+// Draw a circle outline
+void ILI9341_t3::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  drawCircleSpans(x0, y0, r, 0xF, 0, color);
+}
+
 void ILI9341_t3::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                   uint8_t cornername, uint16_t color) {
+  drawCircleSpans(x0, y0, r, cornername, 1, color);
+}
+
+// Walks the outline from x = firstx, one octant at a time. Points that share
+// a y form a horizontal span near the top and bottom of the circle and a
+// vertical one at its sides, so each run is sent as those spans rather than
+// pixel by pixel.
+void ILI9341_t3::drawCircleSpans(int16_t x0, int16_t y0, int16_t r,
+                                 uint8_t cornername, int16_t firstx,
+                                 uint16_t color) {
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x = 0;
   int16_t y = r;
+  int16_t runstart = firstx;
 
+  beginSPITransaction();
+  uint32_t sent = 0;
   while (x < y) {
     if (f >= 0) {
+      drawCircleRun(x0, y0, runstart, x, y, cornername, color, sent);
+      runstart = x + 1;
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -650,22 +1100,35 @@ void ILI9341_t3::drawCircleHelper(int16_t x0, int16_t y0, int16_t r,
     x++;
     ddF_x += 2;
     f += ddF_x;
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    }
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
-    }
+  }
+  drawCircleRun(x0, y0, runstart, x, y, cornername, color, sent);
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
+}
+
+// Draws the outline points from x = xa to xb at y, in each chosen corner
+void ILI9341_t3::drawCircleRun(int16_t x0, int16_t y0, int16_t xa, int16_t xb,
+                               int16_t y, uint8_t cornername, uint16_t color,
+                               uint32_t& sent) {
+  if (xb < xa) {
+    return;
+  }
+  int16_t len = xb - xa + 1;
+  if (cornername & 0x4) {
+    fillSpan(x0 + xa, y0 + y, len, 1, color, sent);
+    fillSpan(x0 + y, y0 + xa, 1, len, color, sent);
+  }
+  if (cornername & 0x2) {
+    fillSpan(x0 + xa, y0 - y, len, 1, color, sent);
+    fillSpan(x0 + y, y0 - xb, 1, len, color, sent);
+  }
+  if (cornername & 0x8) {
+    fillSpan(x0 - y, y0 + xa, 1, len, color, sent);
+    fillSpan(x0 - xb, y0 + y, len, 1, color, sent);
+  }
+  if (cornername & 0x1) {
+    fillSpan(x0 - y, y0 - xb, 1, len, color, sent);
+    fillSpan(x0 - xb, y0 - y, len, 1, color, sent);
   }
 }
 
@@ -674,7 +1137,10 @@ void ILI9341_t3::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
   fillCircleHelper(x0, y0, r, 3, 0, color);
 }
 
-// Used to do circles and roundrects
+// Used to do circles and roundrects. The columns x from the centre only get
+// shorter as x grows, and neighbours of the same height are filled as one
+// rectangle. The columns y from the centre get taller while y holds, so each
+// is filled once, at its final height, when y moves on.
 void ILI9341_t3::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
                                   uint8_t cornername, int16_t delta,
                                   uint16_t color) {
@@ -683,9 +1149,18 @@ void ILI9341_t3::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
   int16_t ddF_y = -2 * r;
   int16_t x = 0;
   int16_t y = r;
+  int16_t runstart = 1;
 
+  beginSPITransaction();
+  uint32_t sent = 0;
   while (x < y) {
     if (f >= 0) {
+      if (x > 0) {
+        fillCircleColumns(x0, y0, runstart, x, y, cornername, delta, color,
+                          sent);
+        fillCircleColumns(x0, y0, y, y, x, cornername, delta, color, sent);
+      }
+      runstart = x + 1;
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -693,16 +1168,34 @@ void ILI9341_t3::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     x++;
     ddF_x += 2;
     f += ddF_x;
-
-    if (cornername & 0x1) {
-      drawFastVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
-      drawFastVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
-    }
-    if (cornername & 0x2) {
-      drawFastVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
-      drawFastVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
+  }
+  if (x > 0) {
+    fillCircleColumns(x0, y0, runstart, x, y, cornername, delta, color, sent);
+    if (y != x) {
+      fillCircleColumns(x0, y0, y, y, x, cornername, delta, color, sent);
     }
   }
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
+}
+
+// Fills the columns xa to xb from the centre, each reaching half rows above
+// and half + delta below it, on the chosen sides
+void ILI9341_t3::fillCircleColumns(int16_t x0, int16_t y0, int16_t xa,
+                                   int16_t xb, int16_t half,
+                                   uint8_t cornername, int16_t delta,
+                                   uint16_t color, uint32_t& sent) {
+  if (xb < xa) {
+    return;
+  }
+  if (cornername & 0x1) {
+    fillSpan(x0 + xa, y0 - half, xb - xa + 1, 2 * half + 1 + delta, color,
+             sent);
+  }
+  if (cornername & 0x2) {
+    fillSpan(x0 - xb, y0 - half, xb - xa + 1, 2 * half + 1 + delta, color,
+             sent);
+  }
 }
 
 // Bresenham's algorithm - thx wikpedia
@@ -749,59 +1242,45 @@ void ILI9341_t3::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     ystep = -1;
   }
 
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  // Each run of pixels along the major axis is one span
+  beginSPITransaction();
+  uint32_t sent = 0;
   int16_t xbegin = x0;
-  if (steep) {
-    for (; x0 <= x1; x0++) {
-      err -= dy;
-      if (err < 0) {
-        int16_t len = x0 - xbegin;
-        if (len) {
-          VLine(y0, xbegin, len + 1, color);
-        } else {
-          Pixel(y0, x0, color);
-        }
-        xbegin = x0 + 1;
-        y0 += ystep;
-        err += dx;
-      }
-    }
-    if (x0 > xbegin + 1) {
-      VLine(y0, xbegin, x0 - xbegin, color);
-    }
-  } else {
-    for (; x0 <= x1; x0++) {
-      err -= dy;
-      if (err < 0) {
-        int16_t len = x0 - xbegin;
-        if (len) {
-          HLine(xbegin, y0, len + 1, color);
-        } else {
-          Pixel(x0, y0, color);
-        }
-        xbegin = x0 + 1;
-        y0 += ystep;
-        err += dx;
+  for (; x0 <= x1; x0++) {
+    err -= dy;
+    if (err < 0) {
+      int16_t len = x0 - xbegin + 1;
+      if (steep) {
+        fillSpan(y0, xbegin, 1, len, color, sent);
+      } else {
+        fillSpan(xbegin, y0, len, 1, color, sent);
       }
+      xbegin = x0 + 1;
+      y0 += ystep;
+      err += dx;
     }
-    if (x0 > xbegin + 1) {
-      HLine(xbegin, y0, x0 - xbegin, color);
+  }
+  if (x0 > xbegin) {
+    if (steep) {
+      fillSpan(y0, xbegin, 1, x0 - xbegin, color, sent);
+    } else {
+      fillSpan(xbegin, y0, x0 - xbegin, 1, color, sent);
     }
   }
   writecommand_last(ILI9341_NOP);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 // Draw a rectangle
 void ILI9341_t3::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
                           uint16_t color) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   HLine(x, y, w, color);
   HLine(x, y + h - 1, w, color);
   VLine(x, y, h, color);
   VLine(x + w - 1, y, h, color);
   writecommand_last(ILI9341_NOP);
-  SPI.endTransaction();
+  endSPITransaction();
 }
 
 // Draw a rounded rectangle
@@ -887,6 +1366,8 @@ void ILI9341_t3::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
   } else {
     last = y1 - 1;  // Skip it
   }
+  beginSPITransaction();
+  uint32_t sent = 0;
   for (y = y0; y <= last; y++) {
     a = x0 + sa / dy01;
     b = x0 + sb / dy02;
@@ -899,7 +1380,7 @@ void ILI9341_t3::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     if (a > b) {
       std::swap(a, b);
     }
-    drawFastHLine(a, y, b - a + 1, color);
+    fillSpan(a, y, b - a + 1, 1, color, sent);
   }
 
   // For lower part of triangle, find scanline crossings for segments
@@ -918,8 +1399,10 @@ void ILI9341_t3::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
     if (a > b) {
       std::swap(a, b);
     }
-    drawFastHLine(a, y, b - a + 1, color);
+    fillSpan(a, y, b - a + 1, 1, color, sent);
   }
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
 }
 
 void ILI9341_t3::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap,
@@ -935,13 +1418,92 @@ void ILI9341_t3::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap,
   }
 }
 
+void ILI9341_t3::drawSprite(int16_t x, int16_t y,
+                            const ILI9341_t3_sprite_t& sprite,
+                            const uint16_t* palette) {
+  int32_t x0 = std::max((int32_t)x, (int32_t)0);
+  int32_t y0 = std::max((int32_t)y, (int32_t)0);
+  int32_t x1 = std::min((int32_t)x + sprite.width, (int32_t)_width);
+  int32_t y1 = std::min((int32_t)y + sprite.height, (int32_t)_height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  if (palette == NULL) {
+    palette = sprite.palette;
+  }
+
+  bool opaque = sprite.transparent == 0xFF;
+  beginSPITransaction();
+  uint32_t sent = 0;
+  if (opaque) {
+    setAddr(x0, y0, x1 - 1, y1 - 1);
+    writecommand_cont(ILI9341_RAMWR);
+  }
+
+  // Rows above the screen are decoded only to reach the visible ones
+  const uint8_t* p = sprite.data;
+  uint32_t index = 0;
+  int32_t count = 0;
+  for (int32_t py = y; py < y1; py++) {
+    for (int32_t px = x; px < x + sprite.width;) {
+      if (count == 0) {
+        uint8_t run = *p++;
+        index = run & 0x0F;
+        count = (run >> 4) + 1;
+        if (count == 16) {
+          count += *p++;
+        }
+      }
+      int32_t n = std::min(count, x + sprite.width - px);
+      int32_t left = std::max(px, x0);
+      int32_t right = std::min(px + n, x1);
+      if (py >= y0 && left < right) {
+        uint16_t color = palette[index];
+        if (opaque) {
+          for (int32_t i = left; i < right; i++) {
+            writedata16_bounded(color, sent);
+          }
+        } else if (index != sprite.transparent) {
+          fillSpan(left, py, right - left, 1, color, sent);
+        }
+      }
+      px += n;
+      count -= n;
+    }
+  }
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
+}
+
+// Feeds one byte of UTF-8 text through the decoder state in codepoint and
+// pending. Returns true once a whole character is in codepoint. Bytes that
+// aren't valid UTF-8 are taken as characters of their own.
+static bool decodeUtf8(uint8_t c, uint32_t& codepoint, uint8_t& pending) {
+  if (pending > 0 && (c & 0xC0) == 0x80) {
+    codepoint = (codepoint << 6) | (c & 0x3F);
+    return --pending == 0;
+  }
+  pending = 0;
+  if (c >= 0xC0 && c < 0xF8) {
+    pending = c < 0xE0 ? 1 : (c < 0xF0 ? 2 : 3);
+    codepoint = c & (0x3F >> pending);
+    return false;
+  }
+  codepoint = c;
+  return true;
+}
+
 size_t ILI9341_t3::write(uint8_t c) {
   if (font) {
-    if (c == '\n') {
+    if (!decodeUtf8(c, utf8char, utf8pending)) {
+      return 1;
+    }
+    if (utf8char == '\n') {
       // cursor_y += ??
       cursor_x = 0;
     } else {
-      drawFontChar(c);
+      drawFontChar(utf8char);
     }
   } else {
     if (c == '\n') {
@@ -1054,7 +1616,7 @@ void ILI9341_t3::drawChar(int16_t x, int16_t y, unsigned char c,
     }
   } else {
     // This solid background approach is about 5 time faster
-    SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+    beginSPITransaction();
     setAddr(x, y, x + 6 * size - 1, y + 8 * size - 1);
     writecommand_cont(ILI9341_RAMWR);
     uint8_t xr, yr;
@@ -1079,7 +1641,7 @@ void ILI9341_t3::drawChar(int16_t x, int16_t y, unsigned char c,
       mask = mask << 1;
     }
     writecommand_last(ILI9341_NOP);
-    SPI.endTransaction();
+    endSPITransaction();
   }
 }
 
@@ -1120,49 +1682,335 @@ static uint32_t fetchbits_signed(const uint8_t* p, uint32_t index,
   return (int32_t)val;
 }
 
-void ILI9341_t3::drawFontChar(unsigned int c) {
-  uint32_t bitoffset;
-  const uint8_t* data;
+// Binary searches the font's sparse table for c, returning the glyph's entry
+// in the index or -1 if the font doesn't have it
+static int32_t findSparseGlyph(const ILI9341_t3_font_t* font, uint32_t c) {
+  const uint8_t* table = font->unicode;
+  uint32_t low = 0;
+  uint32_t high = (table[0] << 8) | table[1];
+  while (low < high) {
+    uint32_t mid = (low + high) / 2;
+    uint32_t codepoint = (table[2 + 2 * mid] << 8) | table[3 + 2 * mid];
+    if (codepoint < c) {
+      low = mid + 1;
+    } else if (codepoint > c) {
+      high = mid;
+    } else {
+      uint32_t entry = font->index1_last - font->index1_first + 1 + mid;
+      if (font->index2_last != 0) {
+        entry += font->index2_last - font->index2_first + 1;
+      }
+      return entry;
+    }
+  }
+  return -1;
+}
 
-  // Serial.printf("drawFontChar %d\n", c);
+// Anti-aliased fonts (version 23 of the format) keep their bits per pixel in
+// the low two bits of reserved: 1 << n for n = 1..3. Their glyphs have the
+// usual header, then one coverage value per pixel, row by row, starting at
+// the next byte boundary.
+static uint32_t fontBitsPerPixel(const ILI9341_t3_font_t* font) {
+  if (font->version != 23 || (font->reserved & 3) == 0) {
+    return 1;
+  }
+  return 1 << (font->reserved & 3);
+}
 
-  if (c >= font->index1_first && c <= font->index1_last) {
-    bitoffset = c - font->index1_first;
+// Scales a pixel's coverage to the 0-15 range of the text blend table
+static uint32_t fetchCoverage(const uint8_t* data, uint32_t bitoffset,
+                              uint32_t bpp) {
+  uint32_t value = fetchbits_unsigned(data, bitoffset, bpp);
+  if (bpp == 2) {
+    return value * 5;
+  }
+  return bpp == 4 ? value : value >> 4;
+}
+
+// Fills lut with the 16 steps from bg to fg, blending each channel of the
+// RGB565 colors separately
+static void blendTextColors(uint16_t fg, uint16_t bg, uint16_t* lut) {
+  for (uint32_t a = 0; a < 16; a++) {
+    uint32_t r = ((fg >> 11) * a + (bg >> 11) * (15 - a) + 7) / 15;
+    uint32_t g =
+        (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (15 - a) + 7) / 15;
+    uint32_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (15 - a) + 7) / 15;
+    lut[a] = (r << 11) | (g << 5) | b;
+  }
+}
+
+// Decodes the next group of identical glyph rows into one run record:
+// [repeat][count] followed by count [x][width] pairs. Returns the record's
+// size and sets n to its repeat count; it is only written if out is given.
+static uint32_t decodeFontRow(const uint8_t* data, uint32_t& bitoffset,
+                              uint32_t width, uint32_t& n, uint8_t* out) {
+  n = 1;
+  if (fetchbit(data, bitoffset++)) {
+    n = fetchbits_unsigned(data, bitoffset, 3) + 2;
+    bitoffset += 3;
+  }
+
+  uint32_t size = 2;
+  uint32_t count = 0;
+
+  // Runs may cross the 32-bit chunks the bits are fetched in
+  uint32_t runstart = 0;
+  bool inrun = false;
+  uint32_t x = 0;
+  do {
+    uint32_t xsize = width - x;
+    if (xsize > 32) {
+      xsize = 32;
+    }
+    uint32_t bits = fetchbits_unsigned(data, bitoffset, xsize);
+    bitoffset += xsize;
+    for (uint32_t bit = xsize; bit > 0; bit--, x++) {
+      if (bits & (1u << (bit - 1))) {
+        if (!inrun) {
+          runstart = x;
+          inrun = true;
+        }
+      } else if (inrun) {
+        if (out) {
+          out[size] = runstart;
+          out[size + 1] = x - runstart;
+        }
+        size += 2;
+        count++;
+        inrun = false;
+      }
+    }
+  } while (x < width);
+  if (inrun) {
+    if (out) {
+      out[size] = runstart;
+      out[size + 1] = width - runstart;
+    }
+    size += 2;
+    count++;
+  }
+
+  if (out) {
+    out[0] = n;
+    out[1] = count;
+  }
+  return size;
+}
+
+// Decodes all of a glyph's rows into the run records ILI9341_t3_GlyphCache
+// stores. Returns the number of bytes needed; written only if out is given.
+static uint32_t decodeFontRuns(const uint8_t* data, uint32_t bitoffset,
+                               uint32_t width, uint32_t height, uint8_t* out) {
+  uint32_t size = 0;
+  int32_t linecount = height;
+  while (linecount > 0) {
+    uint32_t n;
+    size += decodeFontRow(data, bitoffset, width, n, out ? out + size : nullptr);
+    linecount -= n;
+  }
+  return size;
+}
+
+ILI9341_t3_GlyphCache::ILI9341_t3_GlyphCache(uint8_t* buffer, uint32_t size) {
+  // Entries hold pointers, so start them on a suitably aligned address
+  uintptr_t misalign = reinterpret_cast<uintptr_t>(buffer) % alignof(Entry);
+  if (misalign) {
+    uint32_t skip = alignof(Entry) - misalign;
+    buffer += skip;
+    size = (size > skip) ? size - skip : 0;
+  }
+  _buffer = buffer;
+  _size = size;
+  _used = 0;
+  _clock = 0;
+  _hits = 0;
+  _misses = 0;
+  _evictions = 0;
+}
+
+void ILI9341_t3_GlyphCache::clear(void) { _used = 0; }
+
+const ILI9341_t3_GlyphCache::Entry* ILI9341_t3_GlyphCache::find(
+    const ILI9341_t3_font_t* font, uint32_t c) {
+  Entry* entry = const_cast<Entry*>(peek(font, c));
+  if (entry == nullptr) {
+    _misses++;
+    return nullptr;
+  }
+  entry->lastUse = ++_clock;
+  _hits++;
+  return entry;
+}
+
+const ILI9341_t3_GlyphCache::Entry* ILI9341_t3_GlyphCache::peek(
+    const ILI9341_t3_font_t* font, uint32_t c) const {
+  uint32_t offset = 0;
+  while (offset < _used) {
+    const Entry* entry = reinterpret_cast<const Entry*>(_buffer + offset);
+    if (entry->font == font && entry->codepoint == c) {
+      return entry;
+    }
+    offset += entry->size;
+  }
+  return nullptr;
+}
+
+const ILI9341_t3_GlyphCache::Entry* ILI9341_t3_GlyphCache::insert(
+    const ILI9341_t3_font_t* font, uint32_t c, uint32_t width,
+    uint32_t height, int32_t xoffset, int32_t yoffset, uint32_t delta,
+    const uint8_t* data, uint32_t bitoffset) {
+  // Glyphs whose metrics don't fit the entry fields are simply not cached
+  if (width > 255 || height > 255 || xoffset < -128 || xoffset > 127 ||
+      yoffset < -128 || yoffset > 127 || delta > 255) {
+    return nullptr;
+  }
+
+  uint32_t size = sizeof(Entry) +
+                  decodeFontRuns(data, bitoffset, width, height, nullptr);
+  size = (size + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+  if (size > _size || size > 0xFFFF) {
+    return nullptr;
+  }
+  while (_size - _used < size) {
+    evictOldest();
+  }
+
+  Entry* entry = reinterpret_cast<Entry*>(_buffer + _used);
+  entry->font = font;
+  entry->codepoint = c;
+  entry->lastUse = ++_clock;
+  entry->size = size;
+  entry->width = width;
+  entry->height = height;
+  entry->xoffset = xoffset;
+  entry->yoffset = yoffset;
+  entry->delta = delta;
+  decodeFontRuns(data, bitoffset, width, height,
+                 reinterpret_cast<uint8_t*>(entry + 1));
+  _used += size;
+  return entry;
+}
+
+void ILI9341_t3_GlyphCache::evictOldest(void) {
+  Entry* oldest = nullptr;
+  uint32_t offset = 0;
+  while (offset < _used) {
+    Entry* entry = reinterpret_cast<Entry*>(_buffer + offset);
+    if (oldest == nullptr || entry->lastUse < oldest->lastUse) {
+      oldest = entry;
+    }
+    offset += entry->size;
+  }
+
+  // Slide the newer entries down over it to keep the buffer contiguous
+  uint8_t* start = reinterpret_cast<uint8_t*>(oldest);
+  uint32_t size = oldest->size;
+  memmove(start, start + size, _buffer + _used - (start + size));
+  _used -= size;
+  _evictions++;
+}
+
+// Looks up a glyph's metrics, along with either its cached runs or the
+// position of its packed rows. Returns false if the font can't draw it.
+// Only cacheable lookups add misses to the glyph cache, or count toward its
+// statistics and eviction order; the rest, such as measuring, just use what's
+// there.
+bool ILI9341_t3::fetchFontGlyph(unsigned int c, FontGlyph& glyph,
+                                bool cacheable) {
+  uint32_t bitoffset;
+  const uint8_t* data;
+
+  glyph.runs = nullptr;
+  glyph.data = nullptr;
+  glyph.bitoffset = 0;
+  glyph.bpp = fontBitsPerPixel(font);
+
+  // The cache only holds runs of 1 bit per pixel glyphs
+  const ILI9341_t3_GlyphCache::Entry* cached = nullptr;
+  if (glyphcache && glyph.bpp == 1) {
+    cached = cacheable ? glyphcache->find(font, c) : glyphcache->peek(font, c);
+  }
+  if (cached) {
+    glyph.width = cached->width;
+    glyph.height = cached->height;
+    glyph.xoffset = cached->xoffset;
+    glyph.yoffset = cached->yoffset;
+    glyph.delta = cached->delta;
+    glyph.runs = cached->runs();
+    return true;
+  }
+
+  if (c >= font->index1_first && c <= font->index1_last) {
+    bitoffset = c - font->index1_first;
     bitoffset *= font->bits_index;
   } else if (c >= font->index2_first && c <= font->index2_last) {
     bitoffset =
         c - font->index2_first + font->index1_last - font->index1_first + 1;
     bitoffset *= font->bits_index;
   } else if (font->unicode) {
-    return;  // TODO: implement sparse unicode
+    int32_t entry = findSparseGlyph(font, c);
+    if (entry < 0) {
+      return false;
+    }
+    bitoffset = entry * font->bits_index;
   } else {
-    return;
+    return false;
   }
-  // Serial.printf("  index =  %d\n", fetchbits_unsigned(font->index, bitoffset,
-  // font->bits_index));
+  // Serial.printf("  index =  %d\n", fetchbits_unsigned(font->index,
+  // bitoffset, font->bits_index));
   data =
       font->data + fetchbits_unsigned(font->index, bitoffset, font->bits_index);
 
   uint32_t encoding = fetchbits_unsigned(data, 0, 3);
   if (encoding != 0) {
-    return;
+    return false;
   }
-  uint32_t width = fetchbits_unsigned(data, 3, font->bits_width);
+  glyph.width = fetchbits_unsigned(data, 3, font->bits_width);
   bitoffset = font->bits_width + 3;
-  uint32_t height = fetchbits_unsigned(data, bitoffset, font->bits_height);
+  glyph.height = fetchbits_unsigned(data, bitoffset, font->bits_height);
   bitoffset += font->bits_height;
   // Serial.printf("  size =   %d,%d\n", width, height);
 
-  int32_t xoffset = fetchbits_signed(data, bitoffset, font->bits_xoffset);
+  glyph.xoffset = fetchbits_signed(data, bitoffset, font->bits_xoffset);
   bitoffset += font->bits_xoffset;
-  int32_t yoffset = fetchbits_signed(data, bitoffset, font->bits_yoffset);
+  glyph.yoffset = fetchbits_signed(data, bitoffset, font->bits_yoffset);
   bitoffset += font->bits_yoffset;
   // Serial.printf("  offset = %d,%d\n", xoffset, yoffset);
 
-  uint32_t delta = fetchbits_unsigned(data, bitoffset, font->bits_delta);
+  glyph.delta = fetchbits_unsigned(data, bitoffset, font->bits_delta);
   bitoffset += font->bits_delta;
   // Serial.printf("  delta =  %d\n", delta);
 
+  glyph.data = data;
+  glyph.bitoffset = glyph.bpp == 1 ? bitoffset : (bitoffset + 7) & ~7;
+
+  if (glyphcache && cacheable && glyph.bpp == 1) {
+    cached = glyphcache->insert(font, c, glyph.width, glyph.height,
+                                glyph.xoffset, glyph.yoffset, glyph.delta,
+                                data, bitoffset);
+    if (cached) {
+      glyph.runs = cached->runs();
+    }
+  }
+  return true;
+}
+
+void ILI9341_t3::drawFontChar(unsigned int c) {
+  // Serial.printf("drawFontChar %d\n", c);
+
+  FontGlyph glyph;
+  if (!fetchFontGlyph(c, glyph)) {
+    return;
+  }
+  uint32_t width = glyph.width;
+  uint32_t height = glyph.height;
+  int32_t xoffset = glyph.xoffset;
+  int32_t yoffset = glyph.yoffset;
+  uint32_t delta = glyph.delta;
+  const uint8_t* runs = glyph.runs;
+  const uint8_t* data = glyph.data;
+  uint32_t bitoffset = glyph.bitoffset;
+
   // Serial.printf("  cursor = %d,%d\n", cursor_x, cursor_y);
 
   // horizontally, we draw every pixel, or none at all
@@ -1189,12 +2037,43 @@ void ILI9341_t3::drawFontChar(unsigned int c) {
   if (cursor_y >= _height) {
     return;
   }
+  int32_t cell_x = cursor_x;
   cursor_x += delta;
 
   // vertically, the top and/or bottom can be clipped
   int32_t origin_y = cursor_y + font->cap_height - height - yoffset;
   // Serial.printf("  origin = %d,%d\n", origin_x, origin_y);
 
+  if (textcolor != textbgcolor) {
+    drawFontCell(runs, data, bitoffset, glyph.bpp, width, height, origin_x,
+                 origin_y, cell_x, delta);
+    return;
+  }
+  if (glyph.bpp > 1) {
+    // With no background to blend against, pixels at least half covered are
+    // drawn in textcolor
+    for (uint32_t y = 0; y < height; y++) {
+      uint32_t x = 0;
+      do {
+        uint32_t xsize = width - x;
+        if (xsize > 32) {
+          xsize = 32;
+        }
+        uint32_t bits = 0;
+        for (uint32_t i = 0; i < xsize; i++, bitoffset += glyph.bpp) {
+          bits = (bits << 1) | (fetchCoverage(data, bitoffset, glyph.bpp) >= 8);
+        }
+        drawFontBits(bits, xsize, origin_x + x, origin_y + y, 1);
+        x += xsize;
+      } while (x < width);
+    }
+    return;
+  }
+  if (runs) {
+    drawFontRuns(runs, height, origin_x, origin_y);
+    return;
+  }
+
   // TODO: compute top skip and number of lines
   int32_t linecount = height;
   // uint32_t loopcount = 0;
@@ -1242,6 +2121,522 @@ void ILI9341_t3::drawFontChar(unsigned int c) {
   }
 }
 
+// Scanline state of one glyph while drawText() composes its bands
+struct TextGlyph {
+  const uint8_t* record;  // current run record, when drawing cached runs
+  const uint8_t* data;    // packed rows otherwise
+  uint32_t bitoffset;     // header of the current row group in data
+  uint32_t rowbits;       // bits of the current row group in data
+  int32_t x, y;           // glyph origin
+  int32_t groupend;       // first row after the current row group
+  uint16_t width, height;
+  uint8_t bpp;            // above 1, data holds anti-aliased pixels
+  bool loaded;
+};
+
+// Shared by drawText() and a band renderer's whole display list
+static constexpr uint32_t k_maxTextGlyphs =
+    ILI9341_t3_BandRenderer::k_maxTextGlyphs;
+static constexpr uint32_t k_textBandPixels = 1280;  // four 320 px scanlines
+
+static TextGlyph textglyphs[k_maxTextGlyphs];
+static uint16_t textband[k_textBandPixels];
+
+// Where the last layout ran out of room in textglyphs: the first glyph left
+// out and the cursor x in front of it, or nullptr if everything fit
+static const char* textrest;
+static int32_t textrest_x;
+
+// Moves a glyph's state forward to the row group containing row y
+static void advanceTextGlyph(TextGlyph& g, int32_t y) {
+  if (g.bpp > 1) {
+    g.rowbits = g.bitoffset + (y - g.y) * g.width * g.bpp;
+    return;
+  }
+  while (y >= g.groupend) {
+    uint32_t n = 1;
+    if (g.data == nullptr) {
+      if (g.loaded) {
+        g.record += 2 + 2 * g.record[1];
+      }
+      n = g.record[0];
+    } else {
+      if (g.loaded) {
+        g.bitoffset = g.rowbits + g.width;
+      }
+      uint32_t offset = g.bitoffset;
+      if (fetchbit(g.data, offset++)) {
+        n = fetchbits_unsigned(g.data, offset, 3) + 2;
+        offset += 3;
+      }
+      g.rowbits = offset;
+    }
+    g.loaded = true;
+    g.groupend += n;
+  }
+}
+
+// Paints the glyph's current row into one scanline spanning [x0, x1).
+// Anti-aliased pixels take their color from blend by coverage; uncovered
+// ones are left alone.
+static void paintTextGlyph(const TextGlyph& g, uint16_t* line, int32_t x0,
+                           int32_t x1, uint16_t color, const uint16_t* blend) {
+  if (g.bpp > 1) {
+    int32_t start = std::max(g.x, x0);
+    int32_t end = std::min(g.x + (int32_t)g.width, x1);
+    uint32_t bitoffset = g.rowbits + (start - g.x) * g.bpp;
+    for (int32_t x = start; x < end; x++, bitoffset += g.bpp) {
+      uint32_t coverage = fetchCoverage(g.data, bitoffset, g.bpp);
+      if (coverage > 0) {
+        line[x - x0] = blend[coverage];
+      }
+    }
+    return;
+  }
+  if (g.data == nullptr) {
+    const uint8_t* run = g.record + 2;
+    for (uint32_t i = 0; i < g.record[1]; i++, run += 2) {
+      int32_t start = std::max(g.x + run[0], x0);
+      int32_t end = std::min(g.x + run[0] + run[1], x1);
+      for (int32_t x = start; x < end; x++) {
+        line[x - x0] = color;
+      }
+    }
+    return;
+  }
+
+  uint32_t x = 0;
+  while (x < g.width) {
+    uint32_t xsize = g.width - x;
+    if (xsize > 32) {
+      xsize = 32;
+    }
+    uint32_t bits = fetchbits_unsigned(g.data, g.rowbits + x, xsize);
+    for (uint32_t bit = xsize; bit > 0; bit--, x++) {
+      int32_t px = g.x + x;
+      if ((bits & (1u << (bit - 1))) && px >= x0 && px < x1) {
+        line[px - x0] = color;
+      }
+    }
+  }
+}
+
+void ILI9341_t3::measureChar(uint8_t c, uint16_t* w, uint16_t* h) {
+  if (!font) {
+    *w = 6 * textsize;
+    *h = 8 * textsize;
+    return;
+  }
+
+  FontGlyph glyph;
+  *w = fetchFontGlyph(c, glyph, false) ? glyph.delta : 0;
+  *h = font->line_space;
+}
+
+void ILI9341_t3::getTextBounds(const char* str, int16_t x, int16_t y,
+                               int16_t* x1, int16_t* y1, uint16_t* w,
+                               uint16_t* h) {
+  if (!font) {
+    uint32_t len = 0;
+    while (str[len] != '\0' && str[len] != '\n') {
+      len++;
+    }
+    *x1 = x;
+    *y1 = y;
+    *w = len * 6 * textsize;
+    *h = 8 * textsize;
+    return;
+  }
+
+  int32_t left = x;
+  int32_t top = y;
+  int32_t right = x;
+  int32_t bottom = y + font->line_space;
+  int32_t cursor = x;
+  uint32_t c = 0;
+  uint8_t pending = 0;
+  for (const char* p = str; *p != '\0' && *p != '\n'; p++) {
+    FontGlyph glyph;
+    if (!decodeUtf8(*p, c, pending) || !fetchFontGlyph(c, glyph, false)) {
+      continue;
+    }
+    if (glyph.width > 0 && glyph.height > 0) {
+      int32_t gx = cursor + glyph.xoffset;
+      int32_t gy = y + font->cap_height - glyph.height - glyph.yoffset;
+      left = std::min(left, gx);
+      top = std::min(top, gy);
+      right = std::max(right, gx + (int32_t)glyph.width);
+      bottom = std::max(bottom, gy + (int32_t)glyph.height);
+    }
+    cursor += glyph.delta;
+  }
+  right = std::max(right, cursor);
+
+  *x1 = left;
+  *y1 = top;
+  *w = right - left;
+  *h = bottom - top;
+}
+
+// Widths measureText() worked out last, replaced oldest first. Each string
+// is kept to compare against; its FNV-1a hash just rules most out quickly.
+// Longer strings are measured every time.
+static constexpr uint32_t k_maxMeasuredChars = 32;
+
+struct TextMeasure {
+  const ILI9341_t3_font_t* font;
+  uint32_t hash;
+  uint16_t length;
+  uint16_t width;
+  char text[k_maxMeasuredChars];
+};
+static TextMeasure textMeasures[8];
+static uint8_t nextTextMeasure = 0;
+
+void ILI9341_t3::measureText(const ILI9341_t3_font_t& f, const char* str,
+                             uint16_t* w, uint16_t* h) {
+  uint32_t hash = 2166136261u;
+  uint32_t length = 0;
+  for (const char* p = str; *p != '\0' && *p != '\n'; p++) {
+    hash = (hash ^ (uint8_t)*p) * 16777619u;
+    length++;
+  }
+
+  *h = f.line_space;
+  for (const TextMeasure& m : textMeasures) {
+    if (m.font == &f && m.hash == hash && m.length == length &&
+        memcmp(m.text, str, length) == 0) {
+      *w = m.width;
+      return;
+    }
+  }
+
+  // Glyphs are fetched from the current font
+  const ILI9341_t3_font_t* saved = font;
+  font = &f;
+  uint32_t width = 0;
+  uint32_t c = 0;
+  uint8_t pending = 0;
+  for (uint32_t i = 0; i < length; i++) {
+    FontGlyph glyph;
+    if (decodeUtf8(str[i], c, pending) && fetchFontGlyph(c, glyph, false)) {
+      width += glyph.delta;
+    }
+  }
+  font = saved;
+  *w = width;
+  if (length > k_maxMeasuredChars) {
+    return;
+  }
+
+  TextMeasure& m = textMeasures[nextTextMeasure];
+  nextTextMeasure =
+      (nextTextMeasure + 1) % (sizeof(textMeasures) / sizeof(textMeasures[0]));
+  m.font = &f;
+  m.hash = hash;
+  m.length = length;
+  m.width = width;
+  memcpy(m.text, str, length);
+}
+
+void ILI9341_t3::drawText(const char* str) {
+  // A transparent background can't be composed in RAM
+  if (!font || textcolor == textbgcolor) {
+    print(str);
+    return;
+  }
+
+  int32_t x0 = cursor_x;
+  int32_t y0 = cursor_y;
+  uint32_t count = layoutText(str);
+  int32_t x1 = std::max((int32_t)cursor_x, x0);
+  int32_t y1 = y0 + font->line_space;
+  for (uint32_t i = 0; i < count; i++) {
+    x0 = std::min(x0, textglyphs[i].x);
+    x1 = std::max(x1, textglyphs[i].x + textglyphs[i].width);
+    y0 = std::min(y0, textglyphs[i].y);
+    y1 = std::max(y1, textglyphs[i].y + textglyphs[i].height);
+  }
+  renderText(count, x0, y0, x1 - x0, y1 - y0);
+  if (textrest) {
+    drawTextRest(x0, x1);
+  }
+}
+
+void ILI9341_t3::drawText(const char* str, int16_t x, int16_t y, int16_t w,
+                          int16_t h) {
+  if (!font) {
+    fillRect(x, y, w, h, textbgcolor);
+    print(str);
+    return;
+  }
+
+  renderText(layoutText(str), x, y, w, h);
+  if (textrest && cursor_y >= y && cursor_y + font->line_space <= y + h) {
+    drawTextRest(x, x + w);
+  }
+}
+
+// Draws the glyphs that didn't fit in textglyphs one cell at a time, after
+// the composed part of the text. Only glyphs whose cells lie between left and
+// right are drawn, since drawFontChar() can't clip them. The cursor is left
+// where the layout put it.
+void ILI9341_t3::drawTextRest(int32_t left, int32_t right) {
+  left = std::max(left, (int32_t)0);
+  right = std::min(right, (int32_t)_width);
+  int16_t end_x = cursor_x;
+  boolean savedwrap = wrap;
+  wrap = false;
+  cursor_x = textrest_x;
+  uint32_t c = 0;
+  uint8_t pending = 0;
+  for (const char* p = textrest; *p != '\0' && *p != '\n'; p++) {
+    FontGlyph glyph;
+    if (!decodeUtf8(*p, c, pending) || !fetchFontGlyph(c, glyph, false)) {
+      continue;
+    }
+    int32_t origin_x = cursor_x + glyph.xoffset;
+    if (std::min((int32_t)cursor_x, origin_x) < left ||
+        std::max(cursor_x + (int32_t)glyph.delta,
+                 origin_x + (int32_t)glyph.width) > right) {
+      cursor_x += glyph.delta;
+      continue;
+    }
+    drawFontChar(c);
+  }
+  wrap = savedwrap;
+  cursor_x = end_x;
+}
+
+// Places each glyph of str in textglyphs, starting at the cursor, and
+// advances the cursor. Returns the number of visible glyphs placed; textrest
+// marks any that didn't fit.
+uint32_t ILI9341_t3::layoutText(const char* str) {
+  int16_t start_x = cursor_x;
+  textrest = nullptr;
+  uint32_t evictions = glyphcache ? glyphcache->evictions() : 0;
+
+  uint32_t count = placeText(str, 0, true);
+
+  // Caching a later glyph may have evicted an earlier one and moved the runs
+  // it points to, so lay the text out again without adding to the cache
+  if (glyphcache && glyphcache->evictions() != evictions) {
+    cursor_x = start_x;
+    textrest = nullptr;
+    count = placeText(str, 0, false);
+  }
+  return count;
+}
+
+// Single layout pass, placing glyphs from textglyphs[first] onward. Returns
+// the index after the last glyph placed.
+uint32_t ILI9341_t3::placeText(const char* str, uint32_t first,
+                               bool cacheable) {
+  uint32_t count = first;
+  uint32_t c = 0;
+  uint8_t pending = 0;
+  const char* start = str;
+  for (const char* p = str; *p != '\0' && *p != '\n'; p++) {
+    if (pending == 0) {
+      start = p;
+    }
+    FontGlyph glyph;
+    if (!decodeUtf8(*p, c, pending) || !fetchFontGlyph(c, glyph, cacheable)) {
+      continue;
+    }
+
+    int32_t origin_x = cursor_x + glyph.xoffset;
+    cursor_x += glyph.delta;
+    if (glyph.width == 0 || glyph.height == 0 || origin_x >= _width) {
+      continue;
+    }
+    if (count == k_maxTextGlyphs) {
+      if (!textrest) {
+        textrest = start;
+        textrest_x = cursor_x - glyph.delta;
+      }
+      continue;
+    }
+
+    TextGlyph& g = textglyphs[count++];
+    g.record = glyph.runs;
+    g.data = glyph.runs ? nullptr : glyph.data;
+    g.bitoffset = glyph.bitoffset;
+    g.rowbits = 0;
+    g.x = origin_x;
+    g.y = cursor_y + font->cap_height - glyph.height - glyph.yoffset;
+    g.groupend = g.y;
+    g.width = glyph.width;
+    g.height = glyph.height;
+    g.bpp = glyph.bpp;
+    g.loaded = false;
+  }
+  return count;
+}
+
+void ILI9341_t3::renderText(uint32_t count, int16_t x, int16_t y, int16_t w,
+                            int16_t h) {
+  int32_t x0 = std::max((int32_t)x, (int32_t)0);
+  int32_t y0 = std::max((int32_t)y, (int32_t)0);
+  int32_t x1 = std::min((int32_t)x + w, (int32_t)_width);
+  int32_t y1 = std::min((int32_t)y + h, (int32_t)_height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  int32_t boxw = x1 - x0;
+  int32_t bandrows = std::max((int32_t)k_textBandPixels / boxw, (int32_t)1);
+  for (int32_t by = y0; by < y1; by += bandrows) {
+    int32_t rows = std::min(bandrows, y1 - by);
+    uint32_t pixels = rows * boxw;
+    for (uint32_t i = 0; i < pixels; i++) {
+      textband[i] = textbgcolor;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+      TextGlyph& g = textglyphs[i];
+      int32_t top = std::max(by, g.y);
+      int32_t bottom = std::min(by + rows, g.y + (int32_t)g.height);
+      for (int32_t row = top; row < bottom; row++) {
+        advanceTextGlyph(g, row);
+        paintTextGlyph(g, textband + (row - by) * boxw, x0, x1, textcolor,
+                       textblend);
+      }
+    }
+
+    beginSPITransaction();
+    setAddr(x0, by, x1 - 1, by + rows - 1);
+    writecommand_cont(ILI9341_RAMWR);
+    uint32_t sent = 0;
+    for (uint32_t i = 0; i < pixels - 1; i++) {
+      writedata16_bounded(textband[i], sent);
+    }
+    writedata16_last(textband[pixels - 1]);
+    endSPITransaction();
+  }
+}
+
+// Paints a glyph's whole character cell, foreground and background, through a
+// single address window. The cell spans the advance width and the font's line
+// height, widened to cover any part of the glyph that overhangs them.
+void ILI9341_t3::drawFontCell(const uint8_t* runs, const uint8_t* data,
+                              uint32_t bitoffset, uint32_t bpp, uint32_t width,
+                              uint32_t height, int32_t origin_x,
+                              int32_t origin_y, int32_t cell_x,
+                              uint32_t delta) {
+  int32_t x0 = std::min(cell_x, origin_x);
+  int32_t x1 = std::max(cell_x + (int32_t)delta, origin_x + (int32_t)width);
+  int32_t y0 = std::min((int32_t)cursor_y, origin_y);
+  int32_t y1 = std::max(cursor_y + (int32_t)font->line_space,
+                        origin_y + (int32_t)height);
+  x0 = std::max(x0, (int32_t)0);
+  x1 = std::min(x1, (int32_t)_width);
+  y0 = std::max(y0, (int32_t)0);
+  y1 = std::min(y1, (int32_t)_height);
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  // Without a cached copy, each group of rows is decoded as it's reached
+  uint8_t row[2 + 2 * 128];
+  const uint8_t* record = nullptr;
+  uint32_t rowsleft = 0;
+
+  beginSPITransaction();
+  setAddr(x0, y0, x1 - 1, y1 - 1);
+  writecommand_cont(ILI9341_RAMWR);
+  uint32_t sent = 0;
+  for (int32_t y = std::min(y0, origin_y); y < y1; y++) {
+    bool inglyph = y >= origin_y && y < origin_y + (int32_t)height;
+    // Anti-aliased rows are read in place instead
+    bool inruns = inglyph && bpp == 1;
+    if (inruns && rowsleft == 0) {
+      if (runs) {
+        if (record) {
+          runs += 2 + 2 * record[1];
+        }
+        record = runs;
+      } else {
+        uint32_t n;
+        decodeFontRow(data, bitoffset, width, n, row);
+        record = row;
+      }
+      rowsleft = record[0];
+    }
+    if (inruns) {
+      rowsleft--;
+    }
+    if (y < y0) {
+      continue;
+    }
+
+    int32_t x = x0;
+    if (inglyph && bpp > 1) {
+      int32_t end = std::min(origin_x + (int32_t)width, x1);
+      uint32_t pixel = bitoffset + (y - origin_y) * width * bpp;
+      for (; x < origin_x; x++) {
+        writedata16_bounded(textbgcolor, sent);
+      }
+      for (; x < end; x++, pixel += bpp) {
+        writedata16_bounded(textblend[fetchCoverage(data, pixel, bpp)], sent);
+      }
+    } else if (inruns) {
+      const uint8_t* run = record + 2;
+      for (uint32_t i = 0; i < record[1]; i++, run += 2) {
+        int32_t start = origin_x + run[0];
+        int32_t end = std::min(start + run[1], x1);
+        for (; x < start; x++) {
+          writedata16_bounded(textbgcolor, sent);
+        }
+        for (; x < end; x++) {
+          writedata16_bounded(textcolor, sent);
+        }
+      }
+    }
+    for (; x < x1; x++) {
+      writedata16_bounded(textbgcolor, sent);
+    }
+  }
+  writecommand_last(ILI9341_NOP);
+  endSPITransaction();
+}
+
+void ILI9341_t3::drawFontRuns(const uint8_t* runs, uint32_t height, int32_t x,
+                              int32_t y) {
+  int32_t linecount = height;
+  while (linecount > 0) {
+    uint32_t repeat = *runs++;
+    uint32_t count = *runs++;
+    if (count > 0) {
+      beginSPITransaction();
+      uint32_t sent = 0;
+      for (uint32_t row = 0; row < repeat; row++) {
+        writecommand_cont(ILI9341_PASET);  // Row addr set
+        writedata16_cont(y + row);         // YSTART
+        writedata16_cont(y + row);         // YEND
+
+        const uint8_t* run = runs;
+        for (uint32_t i = 0; i < count; i++, run += 2) {
+          uint32_t x1 = x + run[0];
+          uint32_t w = run[1];
+          writecommand_cont(ILI9341_CASET);  // Column addr set
+          writedata16_cont(x1);              // XSTART
+          writedata16_cont(x1 + w - 1);      // XEND
+          writecommand_cont(ILI9341_RAMWR);
+          while (w-- > 1) {  // draw line
+            writedata16_bounded(textcolor, sent);
+          }
+          writedata16_last(textcolor);
+        }
+      }
+      endSPITransaction();
+    }
+    runs += 2 * count;
+    y += repeat;
+    linecount -= repeat;
+  }
+}
+
 void ILI9341_t3::drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x,
                               uint32_t y, uint32_t repeat) {
 #if 0
@@ -1267,7 +2662,8 @@ void ILI9341_t3::drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x,
   if (bits == 0) {
     return;
   }
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
+  uint32_t sent = 0;
   int w = 0;
   do {
     uint32_t x1 = x;
@@ -1288,7 +2684,7 @@ void ILI9341_t3::drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x,
         writedata16_cont(x1);              // XEND
         writecommand_cont(ILI9341_RAMWR);
         while (w-- > 1) {  // draw line
-          writedata16_cont(textcolor);
+          writedata16_bounded(textcolor, sent);
         }
         writedata16_last(textcolor);
       }
@@ -1303,7 +2699,7 @@ void ILI9341_t3::drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x,
       writedata16_cont(x1);              // XEND
       writecommand_cont(ILI9341_RAMWR);
       while (w-- > 1) {  // draw line
-        writedata16_cont(textcolor);
+        writedata16_bounded(textcolor, sent);
       }
       writedata16_last(textcolor);
     }
@@ -1311,7 +2707,7 @@ void ILI9341_t3::drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x,
     y++;
     repeat--;
   } while (repeat);
-  SPI.endTransaction();
+  endSPITransaction();
 #endif
 }
 
@@ -1337,34 +2733,344 @@ uint8_t ILI9341_t3::getTextSize() { return textsize; }
 void ILI9341_t3::setTextColor(uint16_t c) {
   // For 'transparent' background, we'll set the bg
   // to the same as fg instead of using a flag
-  textcolor = textbgcolor = c;
+  setTextColor(c, c);
 }
 
 void ILI9341_t3::setTextColor(uint16_t c, uint16_t b) {
   textcolor = c;
   textbgcolor = b;
+  blendTextColors(c, b, textblend);
 }
 
 void ILI9341_t3::setTextWrap(boolean w) { wrap = w; }
 
 boolean ILI9341_t3::getTextWrap() { return wrap; }
 
-uint8_t ILI9341_t3::getRotation(void) { return rotation; }
+uint8_t ILI9341_t3::getRotation(void) const { return rotation; }
 
 void ILI9341_t3::sleep(bool enable) {
-  SPI.beginTransaction(SPISettings(SPICLOCK, MSBFIRST, SPI_MODE0));
+  beginSPITransaction();
   if (enable) {
     writecommand_cont(ILI9341_DISPOFF);
     writecommand_last(ILI9341_SLPIN);
-    SPI.endTransaction();
+    endSPITransaction();
   } else {
     writecommand_cont(ILI9341_DISPON);
     writecommand_last(ILI9341_SLPOUT);
-    SPI.endTransaction();
+    endSPITransaction();
     delay(5);
   }
 }
 
+ILI9341_t3_BandRenderer::ILI9341_t3_BandRenderer(uint16_t* band0,
+                                                 uint16_t* band1,
+                                                 uint32_t bandPixels)
+    : _bandpixels(bandPixels) {
+  _bands[0] = band0;
+  _bands[1] = band1;
+  clear();
+}
+
+void ILI9341_t3_BandRenderer::clear(void) {
+  _count = 0;
+  _textused = 0;
+  _glyphsused = 0;
+}
+
+bool ILI9341_t3_BandRenderer::fillScreen(uint16_t color) {
+  // The longest side covers both orientations; render() clips the rest
+  return fillRect(0, 0, ILI9341_TFTHEIGHT, ILI9341_TFTHEIGHT, color);
+}
+
+ILI9341_t3_BandRenderer::Command* ILI9341_t3_BandRenderer::addCommand(
+    CommandKind kind, int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t color) {
+  if (_count == k_maxCommands) {
+    return NULL;
+  }
+
+  Command& cmd = _commands[_count++];
+  cmd.x = x;
+  cmd.y = y;
+  cmd.w = w;
+  cmd.h = h;
+  cmd.color = color;
+  cmd.kind = kind;
+  cmd.font = NULL;
+  cmd.pcolors = NULL;
+  cmd.generation = 0;
+  cmd.text = 0;
+  return &cmd;
+}
+
+bool ILI9341_t3_BandRenderer::fillRect(int16_t x, int16_t y, int16_t w,
+                                       int16_t h, uint16_t color) {
+  if ((w <= 0) || (h <= 0)) {
+    return true;
+  }
+  return addCommand(kFillRect, x, y, w, h, color) != NULL;
+}
+
+bool ILI9341_t3_BandRenderer::drawLine(int16_t x0, int16_t y0, int16_t x1,
+                                       int16_t y1, uint16_t color) {
+  return addCommand(kLine, x0, y0, x1, y1, color) != NULL;
+}
+
+bool ILI9341_t3_BandRenderer::writeRect(int16_t x, int16_t y, int16_t w,
+                                        int16_t h, const uint16_t* pcolors,
+                                        uint32_t generation) {
+  if ((w <= 0) || (h <= 0)) {
+    return true;
+  }
+  Command* cmd = addCommand(kWriteRect, x, y, w, h, 0);
+  if (cmd == NULL) {
+    return false;
+  }
+  cmd->pcolors = pcolors;
+  cmd->generation = generation;
+  return true;
+}
+
+bool ILI9341_t3_BandRenderer::drawText(const char* str, int16_t x, int16_t y,
+                                       const ILI9341_t3_font_t& font,
+                                       uint16_t color) {
+  uint32_t len = strlen(str) + 1;
+  if (_textused + len > k_maxTextChars) {
+    return false;
+  }
+
+  // Each character can place at most one glyph, and the whole list's glyphs
+  // are laid out together in render()
+  uint32_t glyphs = 0;
+  uint32_t c = 0;
+  uint8_t pending = 0;
+  for (const char* p = str; *p != '\0' && *p != '\n'; p++) {
+    if (decodeUtf8(*p, c, pending)) {
+      glyphs++;
+    }
+  }
+  if (_glyphsused + glyphs > k_maxTextGlyphs) {
+    return false;
+  }
+
+  Command* cmd = addCommand(kText, x, y, 0, 0, color);
+  if (cmd == NULL) {
+    return false;
+  }
+  cmd->font = &font;
+  cmd->text = _textused;
+  memcpy(_text + _textused, str, len);
+  _textused += len;
+  _glyphsused += glyphs;
+  return true;
+}
+
+void ILI9341_t3_BandRenderer::bounds(ILI9341_t3& display, uint32_t i,
+                                     int16_t* x, int16_t* y, int16_t* w,
+                                     int16_t* h) const {
+  const Command& cmd = _commands[i];
+  *x = cmd.x;
+  *y = cmd.y;
+  *w = cmd.w;
+  *h = cmd.h;
+  if (cmd.kind == kLine) {
+    *x = std::min(cmd.x, cmd.w);
+    *y = std::min(cmd.y, cmd.h);
+    *w = std::max(cmd.x, cmd.w) - *x + 1;
+    *h = std::max(cmd.y, cmd.h) - *y + 1;
+  } else if (cmd.kind == kText) {
+    const ILI9341_t3_font_t* font = display.font;
+    uint16_t textw, texth;
+    display.font = cmd.font;
+    display.getTextBounds(_text + cmd.text, cmd.x, cmd.y, x, y, &textw,
+                          &texth);
+    display.font = font;
+    *w = textw;
+    *h = texth;
+  }
+}
+
+// FNV-1a, over the bytes of value
+template <typename T>
+static uint32_t hashValue(uint32_t hash, const T& value) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  for (uint32_t i = 0; i < sizeof(value); i++) {
+    hash = (hash ^ bytes[i]) * 16777619;
+  }
+  return hash;
+}
+
+uint32_t ILI9341_t3_BandRenderer::signature(uint32_t i) const {
+  const Command& cmd = _commands[i];
+  uint32_t hash = 2166136261;
+  hash = hashValue(hash, cmd.kind);
+  hash = hashValue(hash, cmd.x);
+  hash = hashValue(hash, cmd.y);
+  hash = hashValue(hash, cmd.w);
+  hash = hashValue(hash, cmd.h);
+  hash = hashValue(hash, cmd.color);
+  hash = hashValue(hash, cmd.font);
+  hash = hashValue(hash, cmd.pcolors);
+  hash = hashValue(hash, cmd.generation);
+  if (cmd.kind == kText) {
+    for (const char* p = _text + cmd.text; *p != '\0'; p++) {
+      hash = hashValue(hash, *p);
+    }
+  }
+  return hash;
+}
+
+bool ILI9341_t3_BandRenderer::sameCommand(
+    uint32_t i, const ILI9341_t3_BandRenderer& other, uint32_t j) const {
+  const Command& a = _commands[i];
+  const Command& b = other._commands[j];
+  if (a.kind != b.kind || a.x != b.x || a.y != b.y || a.w != b.w ||
+      a.h != b.h || a.color != b.color || a.font != b.font ||
+      a.pcolors != b.pcolors || a.generation != b.generation) {
+    return false;
+  }
+  return a.kind != kText || strcmp(_text + a.text, other._text + b.text) == 0;
+}
+
+void ILI9341_t3_BandRenderer::render(ILI9341_t3& display) {
+  render(display, 0, 0, display.width(), display.height());
+}
+
+void ILI9341_t3_BandRenderer::render(ILI9341_t3& display, int16_t x,
+                                     int16_t y, int16_t w, int16_t h) {
+  int32_t x0 = std::max((int32_t)x, (int32_t)0);
+  int32_t y0 = std::max((int32_t)y, (int32_t)0);
+  int32_t x1 = std::min((int32_t)x + w, (int32_t)display._width);
+  int32_t y1 = std::min((int32_t)y + h, (int32_t)display._height);
+  int32_t boxw = x1 - x0;
+  if ((boxw <= 0) || (y0 >= y1)) {
+    return;
+  }
+  int32_t bandrows = _bandpixels / boxw;
+  if (bandrows == 0) {
+    return;  // a band buffer must hold at least one row
+  }
+
+  // The last band of the previous frame may still be going out of either
+  // buffer
+  ILI9341_t3::waitAsync();
+
+  // All text is laid out up front. Each glyph then steps through its rows
+  // band by band, top to bottom.
+  const ILI9341_t3_font_t* font = display.font;
+  int16_t cursor_x = display.cursor_x;
+  int16_t cursor_y = display.cursor_y;
+  ILI9341_t3_GlyphCache* cache = display.glyphcache;
+  uint32_t evictions = cache ? cache->evictions() : 0;
+  for (bool cacheable = true;; cacheable = false) {
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < _count; i++) {
+      Command& cmd = _commands[i];
+      if (cmd.kind != kText) {
+        continue;
+      }
+      display.font = cmd.font;
+      display.cursor_x = cmd.x;
+      display.cursor_y = cmd.y;
+      cmd.firstglyph = next;
+      next = display.placeText(_text + cmd.text, next, cacheable);
+      cmd.numglyphs = next - cmd.firstglyph;
+    }
+
+    // As in drawText(), an eviction may have moved runs placed earlier
+    if (!cache || !cacheable || cache->evictions() == evictions) {
+      break;
+    }
+  }
+  display.font = font;
+  display.cursor_x = cursor_x;
+  display.cursor_y = cursor_y;
+
+  uint32_t band = 0;
+  for (int32_t by = y0; by < y1; by += bandrows, band ^= 1) {
+    int32_t rows = std::min(bandrows, y1 - by);
+    int32_t bandend = by + rows;
+    uint16_t* pixels = _bands[band];
+    for (int32_t i = 0; i < rows * boxw; i++) {
+      pixels[i] = ILI9341_BLACK;
+    }
+
+    for (uint32_t i = 0; i < _count; i++) {
+      const Command& cmd = _commands[i];
+      if (cmd.kind == kText) {
+        uint16_t blend[16];
+        if (fontBitsPerPixel(cmd.font) > 1) {
+          blendTextColors(cmd.color, ILI9341_BLACK, blend);
+        }
+        for (uint32_t j = 0; j < cmd.numglyphs; j++) {
+          TextGlyph& g = textglyphs[cmd.firstglyph + j];
+          int32_t top = std::max(by, g.y);
+          int32_t bottom = std::min(bandend, g.y + (int32_t)g.height);
+          for (int32_t row = top; row < bottom; row++) {
+            advanceTextGlyph(g, row);
+            paintTextGlyph(g, pixels + (row - by) * boxw, x0, x1, cmd.color,
+                           blend);
+          }
+        }
+        continue;
+      }
+
+      if (cmd.kind == kLine) {
+        // Bresenham, as ILI9341_t3::drawLine() steps it, keeping the pixels
+        // inside the band
+        int32_t lx0 = cmd.x, ly0 = cmd.y, lx1 = cmd.w, ly1 = cmd.h;
+        bool steep = std::abs(ly1 - ly0) > std::abs(lx1 - lx0);
+        if (steep) {
+          std::swap(lx0, ly0);
+          std::swap(lx1, ly1);
+        }
+        if (lx0 > lx1) {
+          std::swap(lx0, lx1);
+          std::swap(ly0, ly1);
+        }
+        int32_t dx = lx1 - lx0;
+        int32_t dy = std::abs(ly1 - ly0);
+        int32_t err = dx / 2;
+        int32_t ystep = ly0 < ly1 ? 1 : -1;
+        for (; lx0 <= lx1; lx0++) {
+          int32_t px = steep ? ly0 : lx0;
+          int32_t py = steep ? lx0 : ly0;
+          if (px >= x0 && px < x1 && py >= by && py < bandend) {
+            pixels[(py - by) * boxw + px - x0] = cmd.color;
+          }
+          err -= dy;
+          if (err < 0) {
+            ly0 += ystep;
+            err += dx;
+          }
+        }
+        continue;
+      }
+
+      int32_t left = std::max((int32_t)cmd.x, x0);
+      int32_t right = std::min((int32_t)cmd.x + cmd.w, x1);
+      int32_t top = std::max((int32_t)cmd.y, by);
+      int32_t bottom = std::min((int32_t)cmd.y + cmd.h, bandend);
+      for (int32_t row = top; row < bottom; row++) {
+        uint16_t* line = pixels + (row - by) * boxw - x0;
+        if (cmd.kind == kWriteRect) {
+          const uint16_t* src = cmd.pcolors + (row - cmd.y) * cmd.w - cmd.x;
+          for (int32_t col = left; col < right; col++) {
+            line[col] = src[col];
+          }
+        } else {
+          for (int32_t col = left; col < right; col++) {
+            line[col] = cmd.color;
+          }
+        }
+      }
+    }
+
+    // Waits for the previous band, then starts sending this one
+    display.writeRectAsync(x0, by, boxw, rows, pixels);
+  }
+}
+
 void Adafruit_GFX_Button::initButton(ILI9341_t3* gfx, int16_t x, int16_t y,
                                      uint8_t w, uint8_t h, uint16_t outline,
                                      uint16_t fill, uint16_t textcolor,
@@ -23,9 +23,32 @@
 #include "Arduino.h"
 #endif
 
+// Define ILI9341_T3_EMULATOR to build against the host-side emulated panel in
+// host/ instead of the Kinetis SPI0 registers
+#if defined(__cplusplus) && defined(ILI9341_T3_EMULATOR)
+#include "ILI9341_emu.h"
+#endif
+
+// Teensy 3.1 can only generate 30 MHz SPI when running at 120 MHz (overclock)
+// At all other speeds, SPI.beginTransaction() will use the fastest available
+// clock
+#define ILI9341_SPICLOCK 30000000
+
+// Reading GRAM back is much slower; each pixel comes back as three bytes
+#define ILI9341_READCLOCK 2000000
+
+// Default longest run of pixels sent in one SPI transaction before the bus is
+// released; two 320 px rows, about 340 us at 30 MHz
+#define ILI9341_MAX_TRANSACTION 640
+
 #define ILI9341_TFTWIDTH 240
 #define ILI9341_TFTHEIGHT 320
 
+// The panel refreshes from its internal oscillator, scanning the 320 lines
+// plus the two-line front and back porches the init sequence leaves set
+#define ILI9341_FOSC 615000
+#define ILI9341_SCANLINES 324
+
 #define ILI9341_NOP 0x00
 #define ILI9341_SWRESET 0x01
 #define ILI9341_RDDID 0x04
@@ -54,9 +77,12 @@
 #define ILI9341_RAMRD 0x2E
 
 #define ILI9341_PTLAR 0x30
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_TEON 0x35
 #define ILI9341_MADCTL 0x36
 #define ILI9341_VSCRSADD 0x37
 #define ILI9341_PIXFMT 0x3A
+#define ILI9341_GSCAN 0x45
 
 #define ILI9341_FRMCTR1 0xB1
 #define ILI9341_FRMCTR2 0xB2
@@ -107,6 +133,9 @@
 
 typedef struct {
   const unsigned char* index;
+  // Optional table of the characters outside index1 and index2: a count,
+  // then that many codepoints in ascending order, each 16 bits big-endian.
+  // Their index entries follow those of index1 and index2, in table order.
   const unsigned char* unicode;
   const unsigned char* data;
   unsigned char version;
@@ -125,13 +154,95 @@ typedef struct {
   unsigned char cap_height;
 } ILI9341_t3_font_t;
 
+// A paletted image of up to 16 colors, run-length encoded so it can be drawn
+// from flash a run at a time. data holds the pixels row by row, with runs
+// carrying on from one row to the next. Each run starts with a byte whose low
+// 4 bits pick its palette color and whose high 4 bits are its length less
+// one; a length nibble of 15 means the next byte holds the length less 16.
+// tools/SpriteConvert.cpp generates these.
+typedef struct {
+  const unsigned char* data;
+  const unsigned short* palette;
+  unsigned short width;
+  unsigned short height;
+  unsigned char transparent;  // palette index that isn't drawn, or 0xFF
+} ILI9341_t3_sprite_t;
+
 #ifdef __cplusplus
 
+// Keeps recently drawn ILI9341_t3 font glyphs decoded into horizontal pixel
+// runs, so drawing them again skips the packed bitstream entirely. All entries
+// live in a caller-supplied buffer; when it fills, the least recently used
+// glyphs are evicted. One cache may be shared by several displays.
+class ILI9341_t3_GlyphCache {
+ public:
+  ILI9341_t3_GlyphCache(uint8_t* buffer, uint32_t size);
+  void clear(void);
+  uint32_t hits(void) const { return _hits; }
+  uint32_t misses(void) const { return _misses; }
+  uint32_t evictions(void) const { return _evictions; }
+  uint32_t bytesUsed(void) const { return _used; }
+  void resetStats(void) { _hits = _misses = _evictions = 0; }
+
+ private:
+  friend class ILI9341_t3;
+
+  // Followed in the buffer by the glyph's runs: one [repeat][count] pair per
+  // group of identical rows, then count [x][width] pairs
+  struct Entry {
+    const ILI9341_t3_font_t* font;
+    uint32_t codepoint;
+    uint32_t lastUse;
+    uint16_t size;  // bytes, including this header
+    uint8_t width, height;
+    int8_t xoffset, yoffset;
+    uint8_t delta;
+    const uint8_t* runs(void) const {
+      return reinterpret_cast<const uint8_t*>(this + 1);
+    }
+  };
+
+  // Looks a glyph up, counting a hit or miss and marking it used
+  const Entry* find(const ILI9341_t3_font_t* font, uint32_t c);
+  // Looks a glyph up without touching the statistics or eviction order
+  const Entry* peek(const ILI9341_t3_font_t* font, uint32_t c) const;
+  const Entry* insert(const ILI9341_t3_font_t* font, uint32_t c,
+                      uint32_t width, uint32_t height, int32_t xoffset,
+                      int32_t yoffset, uint32_t delta, const uint8_t* data,
+                      uint32_t bitoffset);
+  void evictOldest(void);
+
+  uint8_t* _buffer;
+  uint32_t _size, _used;
+  uint32_t _clock;
+  uint32_t _hits, _misses, _evictions;
+};
+
 class ILI9341_t3 : public Print {
  public:
   ILI9341_t3(uint8_t _CS, uint8_t _DC, uint8_t _RST = 255, uint8_t _MOSI = 11,
              uint8_t _SCLK = 13, uint8_t _MISO = 12);
   void begin(void);
+
+  // Initializes this display and other together. Both must share the SPI bus;
+  // their reset lines are pulsed at the same time, and the init sequence is
+  // broadcast to them once instead of sent to each. The panels are left
+  // waking from sleep with the display off, so the first frame can be drawn
+  // while they do; call displayOn() afterward, broadcasting or on each.
+  void begin(ILI9341_t3& other);
+
+  // Turns the display on once the panel has had the 120 ms it needs after
+  // leaving sleep, waiting out whatever is left of it
+  void displayOn(void);
+
+  // While broadcasting, everything this display sends is also received by
+  // other: both chip selects are asserted together, so an identical command
+  // stream crosses the bus only once. setRotation() keeps other's rotation
+  // and size in step, but its cursor, colors and font are left alone. Don't
+  // read from the display while broadcasting, since both panels would drive
+  // MISO. Pass NULL to stop.
+  void setBroadcast(ILI9341_t3* other);
+
   void sleep(bool enable);
   void pushColor(uint16_t color);
   void fillScreen(uint16_t color);
@@ -140,6 +251,11 @@ class ILI9341_t3 : public Print {
   void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   void setRotation(uint8_t r);
+  // Hardware scrolling runs along the panel's 320-line axis, which is the y
+  // axis in rotations 0 and 2. setScrollArea() makes lines [top, top +
+  // height) a circular window, with the lines above and below it fixed, and
+  // setScroll() selects the line shown at the top of that window.
+  void setScrollArea(uint16_t top, uint16_t height);
   void setScroll(uint16_t offset);
   void invertDisplay(boolean i);
   void setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
@@ -157,6 +273,19 @@ class ILI9341_t3 : public Print {
   void writeRect(int16_t x, int16_t y, int16_t w, int16_t h,
                  const uint16_t* pcolors);
 
+  // Asynchronous versions of fillRect() and writeRect(). The pixels are fed to
+  // SPI0 by DMA while the caller keeps running. Completion is reported through
+  // the callback (run from the DMA interrupt) or by polling asyncBusy(). Only
+  // one transfer can be in flight across all displays, and any other drawing
+  // call waits for it to finish first. pcolors must stay valid until then.
+  void fillRectAsync(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t color, void (*callback)(void) = nullptr);
+  void writeRectAsync(int16_t x, int16_t y, int16_t w, int16_t h,
+                      const uint16_t* pcolors,
+                      void (*callback)(void) = nullptr);
+  static bool asyncBusy(void);
+  static void waitAsync(void);
+
   // from Adafruit_GFX.h
   void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
   void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
@@ -174,6 +303,13 @@ class ILI9341_t3 : public Print {
                      int16_t radius, uint16_t color);
   void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w,
                   int16_t h, uint16_t color);
+
+  // Draws sprite with its top left corner at (x, y), in the colors of
+  // palette if one is given. An opaque sprite goes out through one address
+  // window, its runs decoded straight onto the bus; with a transparent color,
+  // each run of opaque pixels in a row is a window.
+  void drawSprite(int16_t x, int16_t y, const ILI9341_t3_sprite_t& sprite,
+                  const uint16_t* palette = NULL);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
                 uint16_t bg, uint8_t size);
   void setCursor(int16_t x, int16_t y);
@@ -184,29 +320,138 @@ class ILI9341_t3 : public Print {
   void setTextWrap(boolean w);
   boolean getTextWrap();
   virtual size_t write(uint8_t);
-  int16_t width(void) { return _width; }
-  int16_t height(void) { return _height; }
-  uint8_t getRotation(void);
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+  uint8_t getRotation(void) const;
   void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
   void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
   int16_t getCursorX(void) const { return cursor_x; }
   int16_t getCursorY(void) const { return cursor_y; }
+  // Anti-aliased fonts are blended from textbgcolor to textcolor through a
+  // table setTextColor() computes. With a transparent background there's
+  // nothing to blend against, so pixels at least half covered are drawn.
+  // Text in ILI fonts is read as UTF-8.
   void setFont(const ILI9341_t3_font_t& f) { font = &f; }
   void setFontAdafruit(void) { font = NULL; }
+  void setGlyphCache(ILI9341_t3_GlyphCache* cache) { glyphcache = cache; }
+
+  // Bounds how long drawing holds the SPI bus. After this many pixels, a
+  // draw call ends its transaction and begins a new one, giving other SPI
+  // devices and interrupts a chance to run; the panel carries on writing
+  // where it left off. Zero disables the limit. DMA transfers from the
+  // *Async() functions hold the bus until they finish regardless.
+  void setMaxTransaction(uint32_t pixels) { maxtransaction = pixels; }
+  void setMaxTransactionMicros(uint32_t us);
+  uint32_t getMaxTransaction(void) const { return maxtransaction; }
+
+  // Sets the refresh rate as near hz as frame rate control allows, between
+  // about 8 and 119 Hz, and returns the rate chosen. begin() sets 79 Hz.
+  uint32_t setFrameRate(uint32_t hz);
+
+  // Line the panel is refreshing, counted along its 320-line axis: 0 to 319,
+  // then the porches up to ILI9341_SCANLINES - 1. Not while broadcasting.
+  uint16_t readScanline(void);
+
+  // Turns on the panel's tearing effect output, high during vertical
+  // blanking, which is wired to pin. waitForScanout() then syncs to its
+  // rising edge rather than reading the scanline over SPI.
+  void setTearingPin(uint8_t pin);
+
+  // Waits until a write of the area at (x, y) would show in a single refresh,
+  // each line of it first shown whole and all of them together. Portrait
+  // writes move along the panel's lines, so a tall one can start just behind
+  // the beam and stay ahead of its next pass; in landscape, every row written
+  // crosses all the area's lines, so the write is fitted between passes
+  // instead. If neither fits, it starts where the least would tear. Call it
+  // just before the write.
+  void waitForScanout(int16_t x, int16_t y, int16_t w, int16_t h);
   void drawFontChar(unsigned int c);
 
+  // Gives how far printing c advances the cursor, and the line height, in
+  // the current font
+  void measureChar(uint8_t c, uint16_t* w, uint16_t* h);
+
+  // Gives the area printing one line of str at (x, y) would cover in the
+  // current font: the glyphs' boxes together with the text's cell, as
+  // drawText(str) paints it. The cursor isn't moved.
+  void getTextBounds(const char* str, int16_t x, int16_t y, int16_t* x1,
+                     int16_t* y1, uint16_t* w, uint16_t* h);
+
+  // Gives the cell one line of str takes up in font f, the sum of its glyphs'
+  // advances by the line height, as the first form of drawText() paints it.
+  // The last few strings measured, up to 32 characters long, are remembered,
+  // so measuring the same text again each frame is cheap.
+  void measureText(const ILI9341_t3_font_t& f, const char* str, uint16_t* w,
+                   uint16_t* h);
+
+  // Draws one line of ILI font text at the cursor as opaque text, textcolor
+  // on textbgcolor, and advances the cursor past it. Rather than going glyph
+  // by glyph, the area is composed a few scanlines at a time in a RAM buffer
+  // and each band is sent through one address window. The first form paints
+  // the string's own cell (its advance width by the font's line height); the
+  // second fills the given box, clipping the text to it. Text doesn't wrap
+  // and stops at a newline. Glyphs past the first 64 are drawn afterwards one
+  // cell at a time, and only where their whole cell fits.
+  void drawText(const char* str);
+  void drawText(const char* str, int16_t x, int16_t y, int16_t w, int16_t h);
+
+#ifdef ILI9341_T3_EMULATOR
+  ILI9341_Emulator& emulator() { return panel; }
+#endif
+
  protected:
+  friend class ILI9341_t3_BandRenderer;
+
   int16_t _width, _height;  // Display w/h as modified by current rotation
   int16_t cursor_x, cursor_y;
   uint16_t textcolor, textbgcolor;
+  uint16_t textblend[16];  // textbgcolor to textcolor by anti-aliased coverage
   uint8_t textsize, rotation;
   boolean wrap;  // If set, 'wrap' text at right edge of display
   const ILI9341_t3_font_t* font;
+  uint32_t utf8char;  // character being decoded from UTF-8 by write()
+  uint8_t utf8pending;
+  ILI9341_t3_GlyphCache* glyphcache;
+  uint32_t maxtransaction;
+  uint32_t lineperiod;  // ns the panel spends refreshing each line
+  uint8_t _te;          // tearing effect input, or 255
 
   uint8_t _rst;
   uint8_t _cs, _dc;
   uint8_t pcs_data, pcs_command;
+  uint8_t solo_pcs_data, solo_pcs_command;  // without the broadcast display
   uint8_t _miso, _mosi, _sclk;
+  ILI9341_t3* broadcast;
+
+  uint32_t resetmillis;     // when the panel came out of reset
+  uint32_t sleepoutmillis;  // when it was sent SLPOUT
+
+  bool beginPins(void);
+  void reset(ILI9341_t3* other);
+  void sendInitCommands(void);
+
+  void beginSPITransaction(uint32_t clock = ILI9341_SPICLOCK);
+  void endSPITransaction(void);
+
+  void startAsync(const uint16_t* pcolors, uint16_t color, uint32_t count,
+                  void (*callback)(void));
+  void finishAsync(void);
+  static void asyncISR(void);
+
+  // Sends one pixel of a RAMWR stream, counting it in sent. The pixel that
+  // reaches the maxtransaction limit closes the transaction and a new one
+  // begins.
+  void writedata16_bounded(uint16_t d, uint32_t& sent)
+      __attribute__((always_inline)) {
+    if (++sent == maxtransaction) {
+      writedata16_last(d);
+      endSPITransaction();
+      beginSPITransaction();
+      sent = 0;
+    } else {
+      writedata16_cont(d);
+    }
+  }
 
   void setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
       __attribute__((always_inline)) {
@@ -217,6 +462,21 @@ class ILI9341_t3 : public Print {
     writedata16_cont(y0);              // YSTART
     writedata16_cont(y1);              // YEND
   }
+#ifdef ILI9341_T3_EMULATOR
+  ILI9341_Emulator panel;
+
+  // The emulated panel consumes every word immediately, so the FIFO never
+  // fills and there is nothing to wait for
+  void waitFifoNotFull(void) {}
+  void waitFifoEmpty(void) {}
+  void waitTransmitComplete(void) {}
+  void writecommand_cont(uint8_t c) { panel.writeCommand(c); }
+  void writedata8_cont(uint8_t c) { panel.writeData8(c); }
+  void writedata16_cont(uint16_t d) { panel.writeData16(d); }
+  void writecommand_last(uint8_t c) { panel.writeCommand(c); }
+  void writedata8_last(uint8_t c) { panel.writeData8(c); }
+  void writedata16_last(uint16_t d) { panel.writeData16(d); }
+#else
   // void waitFifoNotFull(void) __attribute__((always_inline)) {
   void waitFifoNotFull(void) {
     uint32_t sr;
@@ -294,6 +554,7 @@ class ILI9341_t3 : public Print {
         d | (pcs_data << 16) | SPI_PUSHR_CTAS(1) | SPI_PUSHR_EOQ;
     waitTransmitComplete(mcr);
   }
+#endif  // ILI9341_T3_EMULATOR
   void HLine(int16_t x, int16_t y, int16_t w, uint16_t color)
       __attribute__((always_inline)) {
     setAddr(x, y, x + w - 1, y);
@@ -316,8 +577,129 @@ class ILI9341_t3 : public Print {
     writecommand_cont(ILI9341_RAMWR);
     writedata16_cont(color);
   }
+  struct FontGlyph {
+    uint32_t width, height, delta;
+    int32_t xoffset, yoffset;
+    const uint8_t* runs;  // decoded runs from the glyph cache, if it has them
+    const uint8_t* data;  // otherwise, the packed rows start here
+    uint32_t bitoffset;
+    uint32_t bpp;  // bits per pixel; above 1, data holds anti-aliased pixels
+  };
+  bool fetchFontGlyph(unsigned int c, FontGlyph& glyph, bool cacheable = true);
+  uint32_t layoutText(const char* str);
+  uint32_t placeText(const char* str, uint32_t first, bool cacheable);
+  void renderText(uint32_t count, int16_t x, int16_t y, int16_t w, int16_t h);
+  void drawTextRest(int32_t left, int32_t right);
+  void drawFontRuns(const uint8_t* runs, uint32_t height, int32_t x,
+                    int32_t y);
+  void drawFontCell(const uint8_t* runs, const uint8_t* data,
+                    uint32_t bitoffset, uint32_t bpp, uint32_t width,
+                    uint32_t height, int32_t origin_x, int32_t origin_y,
+                    int32_t cell_x, uint32_t delta);
   void drawFontBits(uint32_t bits, uint32_t numbits, uint32_t x, uint32_t y,
                     uint32_t repeat);
+  void fillSpan(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color,
+                uint32_t& sent);
+  void drawCircleSpans(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+                       int16_t firstx, uint16_t color);
+  void drawCircleRun(int16_t x0, int16_t y0, int16_t xa, int16_t xb, int16_t y,
+                     uint8_t cornername, uint16_t color, uint32_t& sent);
+  void fillCircleColumns(int16_t x0, int16_t y0, int16_t xa, int16_t xb,
+                         int16_t half, uint8_t cornername, int16_t delta,
+                         uint16_t color, uint32_t& sent);
+};
+
+// Draws a whole frame without a framebuffer. Primitives are recorded into a
+// display list; render() then splits the target area into horizontal bands,
+// composes each band in RAM from the list and streams it to the display with
+// writeRectAsync(). The two caller-supplied band buffers are used in turn, so
+// one band is composed while the previous one is still being sent, and every
+// band costs a single address window. Primitives are painted in the order
+// they were added, over black. Text is drawn transparently, like print() with
+// no background color, but doesn't wrap; anti-aliased text is blended against
+// black.
+class ILI9341_t3_BandRenderer {
+ public:
+  static constexpr uint32_t k_maxCommands = 32;
+  static constexpr uint32_t k_maxTextChars = 256;
+  static constexpr uint32_t k_maxTextGlyphs = 64;  // over all text commands
+
+  // Each buffer holds bandPixels pixels; a band is as many whole rows of the
+  // rendered area as fit
+  ILI9341_t3_BandRenderer(uint16_t* band0, uint16_t* band1,
+                          uint32_t bandPixels);
+
+  // Empties the display list. Returns false from the functions below once it
+  // is full.
+  void clear(void);
+  bool fillScreen(uint16_t color);
+  bool fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  bool drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    return fillRect(x, y, w, 1, color);
+  }
+  bool drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    return fillRect(x, y, 1, h, color);
+  }
+
+  bool drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                uint16_t color);
+
+  // pcolors isn't copied, so it must stay valid until the list is cleared.
+  // Commands are compared by pointer, so a caller that changes the pixels in
+  // place passes a different generation to say so.
+  bool writeRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                 const uint16_t* pcolors, uint32_t generation = 0);
+
+  // Text is placed like setCursor(x, y) followed by print(str). Every
+  // character up to the first newline counts toward k_maxTextGlyphs.
+  bool drawText(const char* str, int16_t x, int16_t y,
+                const ILI9341_t3_font_t& font, uint16_t color);
+
+  // Gives the area command i can paint on display
+  void bounds(ILI9341_t3& display, uint32_t i, int16_t* x, int16_t* y,
+              int16_t* w, int16_t* h) const;
+
+  // Hashes everything command i draws with. Commands with different
+  // signatures may paint differently; equal signatures are only a hint, which
+  // sameCommand() confirms. A writeRect()'s pixels aren't read, only its
+  // pointer and generation.
+  uint32_t signature(uint32_t i) const;
+
+  // Whether command i draws exactly what command j of other's list does
+  bool sameCommand(uint32_t i, const ILI9341_t3_BandRenderer& other,
+                   uint32_t j) const;
+
+  // Composes and sends the given area, or the whole display. The last band is
+  // still being sent when this returns.
+  void render(ILI9341_t3& display);
+  void render(ILI9341_t3& display, int16_t x, int16_t y, int16_t w, int16_t h);
+
+  uint32_t size(void) const { return _count; }
+
+ private:
+  enum CommandKind : uint8_t { kFillRect, kLine, kWriteRect, kText };
+
+  struct Command {
+    int16_t x, y, w, h;  // rectangle, text cursor, or a line's two ends
+    uint16_t color;
+    CommandKind kind;
+    const ILI9341_t3_font_t* font;  // text only
+    const uint16_t* pcolors;        // writeRect() only
+    uint32_t generation;            // writeRect() only
+    uint16_t text;                  // offset into _text
+    uint16_t firstglyph, numglyphs;
+  };
+
+  Command* addCommand(CommandKind kind, int16_t x, int16_t y, int16_t w,
+                      int16_t h, uint16_t color);
+
+  uint16_t* _bands[2];
+  uint32_t _bandpixels;
+  Command _commands[k_maxCommands];
+  uint32_t _count;
+  char _text[k_maxTextChars];
+  uint32_t _textused;
+  uint32_t _glyphsused;
 };
 
 class Adafruit_GFX_Button {
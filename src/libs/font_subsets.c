@@ -0,0 +1,649 @@
+// Generated by tools/FontSubset.cpp from src/libs/font_subsets.txt; do not edit.
+
+#include "font_subsets.h"
+
+static const unsigned char Arial_96_Dash_data[] = {
+    0xE0, 0x0F, 0xB0, 0x1B, 0xFD, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x04, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE,
+    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF8,
+    0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00,
+    0x00, 0x03, 0xFF, 0xF0, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF0,
+    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xC0,
+    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x88, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0,
+    0x7F, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC5, 0x1F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xF9, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFB, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x9F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFE, 0xC7, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0x87, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x49, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0x20, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
+    0xFC, 0x20, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFE,
+    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x01, 0xFF,
+    0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFE,
+    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xB8, 0x01,
+    0x28, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,
+    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x07,
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
+    0x03, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF,
+    0x00, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0xFF, 0xF0, 0xFF, 0xFF, 0xCF, 0xFF,
+    0x3F, 0xFF, 0xF8, 0xFF, 0xF7, 0xFF, 0xFF, 0x0F, 0xFF, 0x7F, 0xFF, 0xC0,
+    0xFF, 0xF7, 0xFF, 0xF8, 0x0F, 0xFF, 0x7F, 0xFF, 0x00, 0xFF, 0xF7, 0xFF,
+    0xC0, 0x0F, 0xFF, 0x7F, 0xF0, 0x00, 0xFF, 0xF7, 0xFC, 0x00, 0x0F, 0xFF,
+    0x7F, 0x80, 0x00, 0xFF, 0xF7, 0xE0, 0x00, 0x0F, 0xFF, 0x78, 0x00, 0x00,
+    0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFF, 0xD0, 0x00, 0x00, 0x1F, 0xFF, 0xA0,
+    0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFE, 0x80, 0x00, 0x00,
+    0xFF, 0xFD, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0x03, 0xFF, 0xF4,
+    0x00, 0x00, 0x07, 0xFF, 0xE8, 0x00, 0x00, 0x0F, 0xFF, 0xA0, 0x00, 0x00,
+    0x1F, 0xFE, 0x0F, 0xAF, 0x90, 0x01, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x03, 0xFF, 0xF8,
+    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
+    0xE0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x81, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x1F, 0xFE, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xC3, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA4, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xC0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x24, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x03, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x0F, 0xB0, 0x1B, 0xFD, 0x28, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF8,
+    0x03, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x80,
+    0x01, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+    0x00, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFE, 0x00,
+    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+    0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x03,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x01, 0xFF, 0xF0, 0x41, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x07,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xF0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x60, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xF9, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xE3, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC7, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x1F, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0,
+    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+    0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x10, 0xAF, 0x08, 0x01, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x87, 0xFF, 0x80, 0x04, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x1F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xC0, 0x7F, 0xF8, 0x00, 0x40, 0x00, 0x00, 0xFF, 0xFE,
+    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFC, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x1F, 0xFE,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07,
+    0xFF, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F,
+    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
+    0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+    0x07, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xF0,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8,
+    0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x08, 0x03, 0xFF,
+    0xF8, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x07,
+    0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0F,
+    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00,
+    0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+    0x00, 0x01, 0xFF, 0xE0, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xE0, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xAF,
+    0x9B, 0xFD, 0x2A, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xB0,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x2C, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x20, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x12, 0x03, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+    0x01, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x1F, 0xFF, 0xF0, 0x00,
+    0x00, 0x07, 0xFF, 0xC1, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x8F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x3F, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x3F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xF8, 0x00,
+    0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFE, 0x01,
+    0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x00, 0x00,
+    0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x1F,
+    0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x07, 0xFE, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE4, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFE, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x7F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFC, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE1, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x87,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x7F, 0xFC, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x0F,
+    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F,
+    0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,
+    0x00, 0x10, 0x30, 0x13, 0xFD, 0x28, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x0F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
+    0x0F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+    0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+    0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xE0,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0x88, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFC, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x07, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x0F, 0xC0, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x12, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xFF,
+    0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFF,
+    0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F,
+    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F,
+    0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x8F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01,
+    0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xF7, 0xFF, 0xE0,
+    0x07, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xF0,
+    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x1F, 0xFF, 0xFE, 0x00,
+    0x00, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0x87, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC3, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xF8, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x7F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xCF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xE8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x7F,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x1F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x3F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFC, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE,
+    0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x80, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xC0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0xFF, 0xF8,
+    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x0F,
+    0xAF, 0x18, 0x01, 0x2B, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00,
+    0x80, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x1F, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x50, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x28, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0x80,
+    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x1B, 0xFD,
+    0x28, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
+    0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFE, 0x00, 0x00,
+    0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x0F,
+    0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x3F, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x68, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x10, 0x1F, 0xFE, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x08, 0x07,
+    0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFE,
+    0x00, 0x07, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xE0,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x03, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+    0x83, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x21, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xE3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x9F, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xF1, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xF3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xE7, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA1, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xE1, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x83, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x07, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x7F, 0xFE, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xF8,
+    0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x0F, 0xFF, 0xE0, 0x00,
+    0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0x80,
+    0x1F, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0x00,
+    0x7F, 0xFF, 0xF8, 0x10, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F,
+    0xB0, 0x1B, 0xFD, 0x28, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xFE, 0x00, 0xFF,
+    0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x01, 0xFF,
+    0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFF,
+    0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0F,
+    0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F,
+    0xFC, 0x43, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x07, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xF9, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xDF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xF1, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE3, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC3, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0x87, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x07, 0xFF, 0xF0,
+    0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF,
+    0x00, 0x3F, 0xFE, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF,
+    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC7, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF,
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xF0,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF,
+    0xF0, 0x01, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0x80,
+    0x00, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x07, 0xE0, 0x00, 0x00,
+    0x00, 0x0F, 0xFF, 0x10, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x1F, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x03,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x00, 0x00,
+    0x03, 0xFF, 0xE0, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x0F,
+    0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
+    0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F,
+    0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x15, 0xAF, 0x84, 0x01, 0x64, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xFC, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0,
+    0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0,
+    0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00,
+    0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
+    0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+    0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x03,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xC0, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xC1, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC7,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x9F, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFE, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xF0, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
+    0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x7F,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xC0, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+    0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
+    0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x03,
+    0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
+    0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
+    0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xC0, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80,
+    0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x3F,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFE,
+};
+/* font data size: 6280 bytes */
+
+static const unsigned char Arial_96_Dash_index[] = {
+    0x00, 0x08, 0x71, 0x05, 0x14, 0x4F, 0x93, 0xD3, 0x26, 0x39, 0x71, 0x2E,
+    0x33, 0x7E, 0xA4, 0x8E, 0xE9, 0x72,
+};
+/* font index size: 18 bytes */
+
+const ILI9341_t3_font_t Arial_96_Dash = {Arial_96_Dash_index, 0, Arial_96_Dash_data, 1, 0, 48, 57, 88, 88, 13, 7, 7, 5, 8, 8, 148, 95};
+
+static const unsigned char Arial_48_Dash_data[] = {
+    0xE0, 0x0A, 0xB0, 0x28, 0x06, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x03, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0x00, 0x00, 0x07, 0xFC,
+    0x0F, 0xE0, 0x00, 0x00, 0x7F, 0x82, 0x3F, 0x80, 0x00, 0x00, 0xFF, 0x0B,
+    0xFE, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x00, 0x7F, 0x83, 0xF8,
+    0x00, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xE0, 0x00,
+    0x00, 0xFF, 0x01, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xE0, 0x01, 0xFF, 0x00, 0x01, 0xFC, 0x00,
+    0x0F, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x0F,
+    0xF0, 0x01, 0x1F, 0xC0, 0x00, 0x1F, 0xE0, 0x03, 0xF8, 0x00, 0x01, 0xFE,
+    0x00, 0x8F, 0xE0, 0x00, 0x03, 0xFC, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0xC0,
+    0x47, 0xF0, 0x00, 0x00, 0x7F, 0x81, 0x1F, 0xC0, 0x00, 0x00, 0xFF, 0x03,
+    0xF8, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0xE0, 0x00, 0x00, 0x1F, 0xE1, 0xFC,
+    0x00, 0x00, 0x01, 0xFE, 0x47, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0xFE, 0x00,
+    0x00, 0x00, 0x3F, 0xC0, 0x09, 0xB2, 0x1F, 0xF5, 0xA0, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF,
+    0xFF, 0x80, 0x3F, 0xF8, 0x03, 0xFF, 0x80, 0xFF, 0x80, 0x01, 0xFF, 0x01,
+    0xFE, 0x00, 0x01, 0xFF, 0x03, 0xF8, 0x00, 0x01, 0xFE, 0x0F, 0xF0, 0x00,
+    0x01, 0xFC, 0x1F, 0xC0, 0x00, 0x03, 0xFD, 0x07, 0xF0, 0x00, 0x00, 0x7F,
+    0x41, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFC,
+    0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+    0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x07,
+    0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
+    0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x3F, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x00, 0x00, 0x00, 0x3F, 0xE7, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0xF8, 0x00,
+    0x00, 0x0F, 0xE7, 0xF0, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00, 0x00, 0x3F,
+    0x9F, 0xE0, 0x00, 0x00, 0xFE, 0x1F, 0xE0, 0x00, 0x03, 0xFC, 0x3F, 0xE0,
+    0x00, 0x0F, 0xF8, 0x3F, 0xF0, 0x00, 0x3F, 0xE0, 0x3F, 0xFC, 0x03, 0xFF,
+    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x09, 0xB1, 0x2F, 0xF6, 0x1B, 0xFC,
+    0x00, 0x00, 0x03, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xBF, 0xC0, 0x00,
+    0x00, 0x3F, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xF9, 0xFC, 0x00, 0x00, 0x03,
+    0xFB, 0xF8, 0x00, 0x00, 0x0F, 0xF9, 0x7F, 0x00, 0x00, 0x03, 0xF8, 0xFF,
+    0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x3F, 0xC1, 0xFF, 0x00, 0x00,
+    0xFF, 0x81, 0xFF, 0x00, 0x03, 0xFE, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x3F, 0xF8, 0x00, 0x00, 0x07, 0xF1, 0x1F, 0xF4, 0xA0, 0x01, 0xFF,
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF,
+    0xF8, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x83,
+    0xFE, 0x01, 0xFE, 0x00, 0xFF, 0x03, 0xF8, 0x00, 0x7F, 0x03, 0xF8, 0x00,
+    0x3F, 0x83, 0xF0, 0x00, 0x1F, 0x87, 0xF0, 0x00, 0x1F, 0x94, 0xFC, 0x00,
+    0x01, 0xF9, 0xF8, 0x00, 0x00, 0xFB, 0x7F, 0x00, 0x00, 0x1F, 0xEF, 0xE0,
+    0x00, 0x03, 0xF8, 0xFC, 0x00, 0x00, 0x7F, 0x4F, 0xC0, 0x00, 0x1F, 0x8F,
+    0xE0, 0x00, 0x3F, 0x87, 0xE0, 0x00, 0x3F, 0x07, 0xF0, 0x00, 0x7F, 0x07,
+    0xF8, 0x00, 0xFF, 0x03, 0xFC, 0x01, 0xFE, 0x03, 0xFF, 0x07, 0xFE, 0x01,
+    0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xF0, 0x00,
+    0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x03, 0xFE, 0x00, 0x00,
+    0x04, 0x70, 0x38, 0x04, 0xA0, 0x00, 0x7C, 0x00, 0x07, 0xC0, 0x03, 0xF0,
+    0x01, 0xFC, 0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x1F,
+    0xFF, 0x0F, 0xFF, 0xCF, 0xFB, 0xF7, 0xFC, 0xFD, 0xFE, 0x3F, 0x7E, 0x0F,
+    0xDE, 0x03, 0xF7, 0x00, 0xFF, 0x40, 0x07, 0xFA, 0x00, 0x3F, 0xD0, 0x01,
+    0xFE, 0x80, 0x0F, 0xE4, 0x00, 0x7E, 0x0B, 0x70, 0xF8, 0x05, 0xB0, 0x00,
+    0x00, 0x7F, 0xC0, 0x00, 0x09, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xDF, 0x80, 0x00, 0x40, 0x00,
+    0x0F, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00, 0x00, 0x01,
+    0xFC, 0x7F, 0x00, 0x00, 0x00, 0x07, 0xE1, 0xFC, 0x00, 0x08, 0x00, 0x07,
+    0xF0, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x10, 0x00, 0x1F,
+    0xC0, 0x7F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x20, 0x00, 0x7F,
+    0x00, 0x7F, 0x00, 0x10, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x00, 0x01, 0xF8,
+    0x00, 0x3F, 0x00, 0x20, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x10, 0x01, 0xFC,
+    0x00, 0x07, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x20, 0x07, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x12, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x08, 0x07, 0xF0,
+    0x00, 0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x00, 0x01, 0xFE, 0x10, 0x1F, 0xC0,
+    0x00, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFE, 0x20, 0x7F, 0x00,
+    0x00, 0x00, 0x7F, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x1F, 0xC3, 0xFC, 0x00,
+    0x00, 0x00, 0x7F, 0xA1, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0xF0, 0x00,
+    0x00, 0x00, 0x7F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xFE, 0x08, 0x70, 0x28,
+    0x05, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xE0, 0x00, 0x00, 0x06, 0xFF,
+    0x00, 0x00, 0x00, 0x33, 0xFF, 0xFF, 0xFF, 0xE1, 0xBF, 0xC0, 0x00, 0x00,
+    0x0D, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x01, 0xFC, 0x00,
+    0x00, 0x00, 0x07, 0xB0, 0x28, 0x04, 0xBB, 0xFC, 0x00, 0x00, 0x06, 0xFF,
+    0x00, 0x00, 0x01, 0xBF, 0xC0, 0x00, 0x00, 0x6F, 0xF0, 0x00, 0x00, 0x1B,
+    0xFC, 0x00, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x0B, 0xF0, 0x20, 0x06, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF3,
+    0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x0F, 0xFF,
+    0xBF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xCF, 0xF7, 0xE0, 0x00, 0x03, 0xF7,
+    0xF9, 0xFE, 0x7E, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0xC7, 0xE0, 0x00, 0x3F,
+    0x1F, 0xDF, 0xC7, 0xF0, 0x00, 0x7F, 0x1F, 0xE7, 0xF8, 0x7E, 0x00, 0x0F,
+    0xC3, 0xFC, 0xFF, 0x07, 0xE0, 0x03, 0xF0, 0x7F, 0x9F, 0xE0, 0x7E, 0x00,
+    0xFC, 0x0F, 0xEF, 0xE0, 0x7F, 0x01, 0xFC, 0x0F, 0xF3, 0xFC, 0x07, 0xE0,
+    0x3F, 0x01, 0xFE, 0x7F, 0x80, 0x7E, 0x0F, 0xC0, 0x3F, 0xBF, 0x80, 0x7F,
+    0x1F, 0xC0, 0x3F, 0xC7, 0xF0, 0x07, 0xE3, 0xF0, 0x07, 0xF7, 0xF0, 0x07,
+    0xE7, 0xF0, 0x07, 0xF9, 0xFE, 0x00, 0x7E, 0xFC, 0x00, 0xFF, 0x5F, 0xC0,
+    0x07, 0xFF, 0x00, 0x1F, 0xE7, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xF8,
+};
+/* font data size: 1103 bytes */
+
+static const unsigned char Arial_48_Dash_index[] = {
+    0x00, 0x23, 0x40, 0x00, 0x1B, 0x64, 0x2A, 0xA5, 0x16, 0x53, 0x81, 0x75,
+    0x4F, 0x34,
+};
+/* font index size: 14 bytes */
+
+static const unsigned char Arial_48_Dash_unicode[] = {
+    0x00, 0x04, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4C, 0x00, 0x4D,
+};
+/* font unicode size: 10 bytes */
+
+const ILI9341_t3_font_t Arial_48_Dash = {Arial_48_Dash_index, Arial_48_Dash_unicode, Arial_48_Dash_data, 1, 0, 82, 85, 48, 49, 11, 7, 6, 5, 7, 7, 74, 48};
+
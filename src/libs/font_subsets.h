@@ -0,0 +1,19 @@
+// Generated by tools/FontSubset.cpp from src/libs/font_subsets.txt; do not edit.
+
+#ifndef _ILI9341_t3_font_subsets_
+#define _ILI9341_t3_font_subsets_
+
+#include "ILI9341_t3.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const ILI9341_t3_font_t Arial_96_Dash;
+extern const ILI9341_t3_font_t Arial_48_Dash;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+// Generated by tools/SpriteConvert.cpp from src/libs/sprites.txt; do not edit.
+
+#include "sprites.h"
+
+static const unsigned char Sprite_Caret_data[] = {
+    0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80,
+    0x31, 0x80, 0x31, 0x80, 0x31, 0x70, 0x31, 0x60, 0x31, 0x60, 0x31, 0x60,
+    0x31, 0x60, 0x31, 0x60, 0x31, 0x60, 0x31, 0x60, 0x31, 0x60, 0x31, 0x70,
+};
+
+static const unsigned short Sprite_Caret_palette[] = {0x0000, 0xFFE0};
+
+const ILI9341_t3_sprite_t Sprite_Caret = {Sprite_Caret_data, Sprite_Caret_palette, 12, 18, 0};
+/* 12x18, 40 bytes */
+
+static const unsigned char Sprite_Warning_data[] = {
+    0xB0, 0x02, 0xF0, 0x07, 0x22, 0xF0, 0x06, 0x22, 0xF0, 0x05, 0x12, 0x01,
+    0x12, 0xF0, 0x04, 0x12, 0x01, 0x12, 0xF0, 0x03, 0x12, 0x21, 0x12, 0xF0,
+    0x02, 0x12, 0x21, 0x12, 0xF0, 0x01, 0x12, 0x01, 0x22, 0x01, 0x12, 0xE0,
+    0x22, 0x01, 0x22, 0x01, 0x22, 0xD0, 0x12, 0x11, 0x22, 0x11, 0x12, 0xC0,
+    0x12, 0x21, 0x22, 0x21, 0x12, 0xB0, 0x12, 0x21, 0x22, 0x21, 0x12, 0xA0,
+    0x12, 0x31, 0x22, 0x31, 0x12, 0x90, 0x12, 0x31, 0x22, 0x31, 0x12, 0x80,
+    0x12, 0x41, 0x22, 0x41, 0x12, 0x60, 0x22, 0xC1, 0x22, 0x50, 0x12, 0x51,
+    0x22, 0x51, 0x12, 0x40, 0x12, 0x61, 0x22, 0x61, 0x12, 0x30, 0x12, 0x61,
+    0x22, 0x61, 0x12, 0x20, 0x12, 0xF1, 0x03, 0x12, 0x10, 0xF2, 0x07, 0x00,
+    0xF2, 0x09,
+};
+
+static const unsigned short Sprite_Warning_palette[] = {0x0000, 0xFFE0, 0x0000};
+
+const ILI9341_t3_sprite_t Sprite_Warning = {Sprite_Warning_data, Sprite_Warning_palette, 25, 22, 0};
+/* 25x22, 116 bytes */
+
+static const unsigned char Sprite_Logo_data[] = {
+    0xF2, 0x5A, 0xF0, 0x20, 0x32, 0xF0, 0x20, 0x32, 0x30, 0xF1, 0x00, 0x90,
+    0xB1, 0x50, 0x32, 0x30, 0xF1, 0x00, 0x90, 0xB1, 0x50, 0x32, 0x30, 0xF1,
+    0x00, 0x70, 0xD1, 0x50, 0x32, 0x30, 0xF1, 0x00, 0x70, 0xD1, 0x50, 0x32,
+    0x30, 0x31, 0xF0, 0x02, 0x31, 0xF0, 0x02, 0x32, 0x30, 0x31, 0xF0, 0x02,
+    0x31, 0xF0, 0x02, 0x32, 0x30, 0x31, 0xF0, 0x02, 0x31, 0xF0, 0x02, 0x32,
+    0x30, 0x31, 0xF0, 0x02, 0x31, 0xF0, 0x02, 0x32, 0x30, 0xB1, 0xB0, 0xB1,
+    0x70, 0x32, 0x30, 0xB1, 0xB0, 0xB1, 0x70, 0x32, 0x30, 0xB1, 0xD0, 0xB1,
+    0x50, 0x32, 0x30, 0xB1, 0xD0, 0xB1, 0x50, 0x32, 0x30, 0x31, 0xF0, 0x0E,
+    0x31, 0x50, 0x32, 0x30, 0x31, 0xF0, 0x0E, 0x31, 0x50, 0x32, 0x30, 0x31,
+    0xF0, 0x0E, 0x31, 0x50, 0x32, 0x30, 0x31, 0xF0, 0x0E, 0x31, 0x50, 0x32,
+    0x30, 0x31, 0xF0, 0x02, 0xD1, 0x70, 0x32, 0x30, 0x31, 0xF0, 0x02, 0xD1,
+    0x70, 0x32, 0x30, 0x31, 0xF0, 0x02, 0xB1, 0x90, 0x32, 0x30, 0x31, 0xF0,
+    0x02, 0xB1, 0x90, 0x32, 0xF0, 0x20, 0x32, 0xF0, 0x20, 0xF2, 0x5A,
+};
+
+static const unsigned short Sprite_Logo_palette[] = {0x0000, 0xFFFF, 0xF800};
+
+const ILI9341_t3_sprite_t Sprite_Logo = {Sprite_Logo_data, Sprite_Logo_palette, 52, 28, 255};
+/* 52x28, 161 bytes */
+
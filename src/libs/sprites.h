@@ -0,0 +1,20 @@
+// Generated by tools/SpriteConvert.cpp from src/libs/sprites.txt; do not edit.
+
+#ifndef _ILI9341_t3_sprites_
+#define _ILI9341_t3_sprites_
+
+#include "ILI9341_t3.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const ILI9341_t3_sprite_t Sprite_Caret;
+extern const ILI9341_t3_sprite_t Sprite_Warning;
+extern const ILI9341_t3_sprite_t Sprite_Logo;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
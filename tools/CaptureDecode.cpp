@@ -0,0 +1,260 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+/* @desc Screen capture decoder. Reads a recording of the firmware's serial
+ *       output, finds the chunks ScreenCapture wrote among any other text,
+ *       and saves each complete frame as a PNG image.
+ *
+ *       Usage: capture_decode <recording> [output directory]
+ *
+ *       Frames are written as panel<N>_frame<NNNN>.png, numbered in the
+ *       order they finish. A frame missing a row, or holding one whose
+ *       checksum doesn't match, is skipped, since every later row in it is
+ *       encoded against the one above.
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+constexpr uint8_t kSync[2] = {0xFC, 0x51};
+constexpr uint32_t kHeaderSize = 12;
+
+struct Frame {
+  uint8_t id = 0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  // The row expected next, or height if a row was lost
+  uint32_t nextRow = 0;
+  std::vector<uint16_t> pixels;
+};
+
+static uint32_t readU16(const uint8_t* in) { return in[0] | in[1] << 8; }
+
+static void putU32BE(std::string& out, uint32_t value) {
+  for (int32_t shift = 24; shift >= 0; shift -= 8) {
+    out += static_cast<char>(value >> shift);
+  }
+}
+
+static uint32_t crc32(const std::string& data, size_t begin) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = begin; i < data.size(); i++) {
+    crc ^= static_cast<uint8_t>(data[i]);
+    for (uint32_t bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+static void putChunk(std::string& png, const char* type,
+                     const std::string& data) {
+  putU32BE(png, data.size());
+  size_t begin = png.size();
+  png += type;
+  png += data;
+  putU32BE(png, crc32(png, begin));
+}
+
+/* Writes an 8 bit RGB PNG. The image data goes in stored (uncompressed)
+ * deflate blocks, which keeps this free of a zlib dependency.
+ */
+static bool writePNG(const std::string& path, const Frame& frame) {
+  std::string raw;
+  for (uint32_t y = 0; y < frame.height; y++) {
+    raw += '\0';
+    for (uint32_t x = 0; x < frame.width; x++) {
+      uint16_t color = frame.pixels[y * frame.width + x];
+      uint8_t r = (color >> 11) & 0x1F;
+      uint8_t g = (color >> 5) & 0x3F;
+      uint8_t b = color & 0x1F;
+      raw += static_cast<char>(r << 3 | r >> 2);
+      raw += static_cast<char>(g << 2 | g >> 4);
+      raw += static_cast<char>(b << 3 | b >> 2);
+    }
+  }
+
+  std::string zlib = "\x78\x01";
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (char c : raw) {
+    a = (a + static_cast<uint8_t>(c)) % 65521;
+    b = (b + a) % 65521;
+  }
+  for (size_t offset = 0; offset < raw.size(); offset += 65535) {
+    size_t size = std::min<size_t>(raw.size() - offset, 65535);
+    zlib += static_cast<char>(offset + size == raw.size());
+    zlib += static_cast<char>(size & 0xFF);
+    zlib += static_cast<char>(size >> 8);
+    zlib += static_cast<char>(~size & 0xFF);
+    zlib += static_cast<char>((~size >> 8) & 0xFF);
+    zlib.append(raw, offset, size);
+  }
+  putU32BE(zlib, b << 16 | a);
+
+  std::string header;
+  putU32BE(header, frame.width);
+  putU32BE(header, frame.height);
+  header += "\x08\x02";  // 8 bits per channel, RGB
+  header += std::string(3, '\0');
+
+  std::string png = "\x89PNG\r\n\x1a\n";
+  putChunk(png, "IHDR", header);
+  putChunk(png, "IDAT", zlib);
+  putChunk(png, "IEND", "");
+
+  std::ofstream file(path, std::ios::binary);
+  file.write(png.data(), png.size());
+  return static_cast<bool>(file);
+}
+
+/* Decodes a row's payload into the frame, against the row above it. Returns
+ * false if the payload doesn't describe exactly one row.
+ */
+static bool decodeRow(Frame& frame, uint32_t row, const uint8_t* payload,
+                      uint32_t length) {
+  uint16_t* out = &frame.pixels[row * frame.width];
+  const uint16_t* above = row > 0 ? out - frame.width : nullptr;
+  const uint8_t* end = payload + length;
+  uint32_t x = 0;
+
+  while (payload < end) {
+    uint8_t tag = *payload++;
+    uint32_t count = (tag & 0x3F) + 1;
+    if (tag >= 0x80) {
+      count = tag - 0x80 + 1;
+    }
+    if (x + count > frame.width) {
+      return false;
+    }
+
+    if (tag < 0x40) {
+      for (uint32_t i = 0; i < count; i++, x++) {
+        out[x] = above != nullptr ? above[x] : 0;
+      }
+    } else if (tag < 0x80) {
+      if (end - payload < 2) {
+        return false;
+      }
+      uint16_t color = readU16(payload);
+      payload += 2;
+      for (uint32_t i = 0; i < count; i++) {
+        out[x++] = color;
+      }
+    } else {
+      if (static_cast<uint32_t>(end - payload) < 2 * count) {
+        return false;
+      }
+      for (uint32_t i = 0; i < count; i++) {
+        out[x++] = readU16(payload);
+        payload += 2;
+      }
+    }
+  }
+  return x == frame.width;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 2 && argc != 3) {
+    std::fprintf(stderr, "usage: %s <recording> [output directory]\n",
+                 argv[0]);
+    return 1;
+  }
+
+  std::ifstream file(argv[1], std::ios::binary);
+  if (!file) {
+    std::fprintf(stderr, "can't read %s\n", argv[1]);
+    return 1;
+  }
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+  std::string directory = argc > 2 ? argv[2] : ".";
+
+  std::map<uint8_t, Frame> frames;
+  uint32_t written = 0;
+  uint32_t skipped = 0;
+  uint32_t badChunks = 0;
+
+  size_t pos = 0;
+  while (pos + kHeaderSize + 1 <= data.size()) {
+    const uint8_t* chunk = &data[pos];
+    if (chunk[0] != kSync[0] || chunk[1] != kSync[1]) {
+      pos++;
+      continue;
+    }
+
+    uint8_t panel = chunk[2];
+    uint8_t id = chunk[3];
+    uint32_t row = readU16(chunk + 4);
+    uint32_t width = readU16(chunk + 6);
+    uint32_t height = readU16(chunk + 8);
+    uint32_t length = readU16(chunk + 10);
+    if (pos + kHeaderSize + length + 1 > data.size()) {
+      pos++;
+      continue;
+    }
+
+    uint8_t checksum = 0;
+    for (uint32_t i = 2; i < kHeaderSize + length; i++) {
+      checksum += chunk[i];
+    }
+    if (checksum != chunk[kHeaderSize + length] || row >= height) {
+      // Not a chunk, or one cut short by other output; resynchronize
+      badChunks++;
+      pos++;
+      continue;
+    }
+    pos += kHeaderSize + length + 1;
+
+    Frame& frame = frames[panel];
+    if (row == 0) {
+      if (frame.nextRow > 0 && frame.nextRow < frame.height) {
+        skipped++;
+      }
+      frame.id = id;
+      frame.width = width;
+      frame.height = height;
+      frame.nextRow = 0;
+      frame.pixels.assign(width * height, 0);
+    }
+    if (frame.id != id || frame.width != width || frame.height != height ||
+        frame.nextRow != row) {
+      if (frame.nextRow < frame.height) {
+        frame.nextRow = frame.height;
+        skipped++;
+      }
+      continue;
+    }
+
+    if (!decodeRow(frame, row, chunk + kHeaderSize, length)) {
+      frame.nextRow = frame.height;
+      skipped++;
+      continue;
+    }
+    frame.nextRow++;
+
+    if (frame.nextRow == frame.height) {
+      char name[40];
+      std::snprintf(name, sizeof(name), "/panel%u_frame%04u.png", panel,
+                    written);
+      std::string path = directory + name;
+      if (!writePNG(path, frame)) {
+        std::fprintf(stderr, "failed to write %s\n", path.c_str());
+        return 1;
+      }
+      std::printf("%s\n", path.c_str());
+      written++;
+    }
+  }
+
+  std::printf("%u frames written, %u incomplete, %u bad chunks\n", written,
+              skipped, badChunks);
+  return 0;
+}
@@ -0,0 +1,458 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+/* @desc Font subsetting tool. Reads a manifest naming subsets of the
+ *       ILI9341_t3 fonts and the characters each keeps, then writes font
+ *       tables holding only those glyphs, with an index covering only the
+ *       range they span.
+ *
+ *       Usage: font_subset <manifest> <output path without extension>
+ *
+ *       Each manifest line is "<subset name> <source font> <characters>";
+ *       everything after the single space following the source font is kept,
+ *       so a space can be included. Blank lines and lines starting with '#'
+ *       are ignored.
+ */
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "font_Arial.h"
+#include "font_ArialBold.h"
+
+#define FONT_ENTRY(font) \
+  { #font, &font }
+
+struct FontEntry {
+  const char* name;
+  const ILI9341_t3_font_t* font;
+};
+
+static const FontEntry kFonts[] = {
+    FONT_ENTRY(Arial_8),       FONT_ENTRY(Arial_9),
+    FONT_ENTRY(Arial_10),      FONT_ENTRY(Arial_11),
+    FONT_ENTRY(Arial_12),      FONT_ENTRY(Arial_13),
+    FONT_ENTRY(Arial_14),      FONT_ENTRY(Arial_16),
+    FONT_ENTRY(Arial_18),      FONT_ENTRY(Arial_20),
+    FONT_ENTRY(Arial_24),      FONT_ENTRY(Arial_28),
+    FONT_ENTRY(Arial_32),      FONT_ENTRY(Arial_40),
+    FONT_ENTRY(Arial_48),      FONT_ENTRY(Arial_60),
+    FONT_ENTRY(Arial_72),      FONT_ENTRY(Arial_96),
+    FONT_ENTRY(Arial_8_Bold),  FONT_ENTRY(Arial_9_Bold),
+    FONT_ENTRY(Arial_10_Bold), FONT_ENTRY(Arial_11_Bold),
+    FONT_ENTRY(Arial_12_Bold), FONT_ENTRY(Arial_13_Bold),
+    FONT_ENTRY(Arial_14_Bold), FONT_ENTRY(Arial_16_Bold),
+    FONT_ENTRY(Arial_18_Bold), FONT_ENTRY(Arial_20_Bold),
+    FONT_ENTRY(Arial_24_Bold), FONT_ENTRY(Arial_28_Bold),
+    FONT_ENTRY(Arial_32_Bold), FONT_ENTRY(Arial_40_Bold),
+    FONT_ENTRY(Arial_48_Bold), FONT_ENTRY(Arial_60_Bold),
+    FONT_ENTRY(Arial_72_Bold), FONT_ENTRY(Arial_96_Bold),
+};
+
+/* Index entries for characters inside a subset's ranges that it doesn't keep
+ * point at this byte. Its glyph encoding field is nonzero, which the library
+ * treats as no glyph.
+ */
+constexpr uint8_t kAbsentGlyph = 0xE0;
+
+struct Subset {
+  std::string name;
+  const ILI9341_t3_font_t* font;
+  std::set<uint32_t> chars;
+};
+
+struct Range {
+  uint32_t first;
+  uint32_t last;
+};
+
+static uint32_t fetchBits(const uint8_t* p, uint32_t index, uint32_t count) {
+  uint32_t val = 0;
+  for (uint32_t i = 0; i < count; i++, index++) {
+    val = (val << 1) | ((p[index >> 3] >> (7 - (index & 7))) & 1);
+  }
+  return val;
+}
+
+static void storeBits(std::vector<uint8_t>& out, uint32_t index,
+                      uint32_t count, uint32_t val) {
+  for (uint32_t i = 0; i < count; i++, index++) {
+    if (val & (1 << (count - 1 - i))) {
+      out[index >> 3] |= 0x80 >> (index & 7);
+    }
+  }
+}
+
+// Decodes UTF-8 a byte at a time, the same way the library does
+static bool decodeUtf8(uint8_t c, uint32_t& codepoint, uint8_t& pending) {
+  if (pending > 0 && (c & 0xC0) == 0x80) {
+    codepoint = (codepoint << 6) | (c & 0x3F);
+    return --pending == 0;
+  }
+  pending = 0;
+  if (c >= 0xC0 && c < 0xF8) {
+    pending = c < 0xE0 ? 1 : (c < 0xF0 ? 2 : 3);
+    codepoint = c & (0x3F >> pending);
+    return false;
+  }
+  codepoint = c;
+  return true;
+}
+
+static const ILI9341_t3_font_t* findFont(const std::string& name) {
+  for (const auto& entry : kFonts) {
+    if (name == entry.name) {
+      return entry.font;
+    }
+  }
+  return nullptr;
+}
+
+static uint32_t sparseCount(const ILI9341_t3_font_t& font) {
+  return font.unicode ? (font.unicode[0] << 8) | font.unicode[1] : 0;
+}
+
+static uint32_t sparseCodepoint(const ILI9341_t3_font_t& font, uint32_t i) {
+  return (font.unicode[2 + 2 * i] << 8) | font.unicode[3 + 2 * i];
+}
+
+static uint32_t denseEntries(const ILI9341_t3_font_t& font) {
+  uint32_t entries = font.index1_last - font.index1_first + 1;
+  if (font.index2_last != 0) {
+    entries += font.index2_last - font.index2_first + 1;
+  }
+  return entries;
+}
+
+// Returns the glyph for c in the full font, or nullptr if it has none
+static const uint8_t* findGlyph(const ILI9341_t3_font_t& font, uint32_t c) {
+  uint32_t entry;
+  if (c >= font.index1_first && c <= font.index1_last) {
+    entry = c - font.index1_first;
+  } else if (c >= font.index2_first && c <= font.index2_last) {
+    entry = c - font.index2_first + font.index1_last - font.index1_first + 1;
+  } else {
+    uint32_t count = sparseCount(font);
+    uint32_t i = 0;
+    while (i < count && sparseCodepoint(font, i) != c) {
+      i++;
+    }
+    if (i == count) {
+      return nullptr;
+    }
+    entry = denseEntries(font) + i;
+  }
+
+  const uint8_t* glyph =
+      font.data + fetchBits(font.index, entry * font.bits_index,
+                            font.bits_index);
+  if (fetchBits(glyph, 0, 3) != 0) {
+    return nullptr;
+  }
+  return glyph;
+}
+
+/* Walks the glyph's header and row groups, the same way the library decodes
+ * them, to find how many bytes it takes
+ */
+static uint32_t glyphSize(const ILI9341_t3_font_t& font, const uint8_t* glyph) {
+  uint32_t width = fetchBits(glyph, 3, font.bits_width);
+  uint32_t bit = 3 + font.bits_width;
+  uint32_t height = fetchBits(glyph, bit, font.bits_height);
+  bit += font.bits_height + font.bits_xoffset + font.bits_yoffset +
+         font.bits_delta;
+
+  uint32_t rows = 0;
+  while (rows < height) {
+    uint32_t repeat = 1;
+    if (fetchBits(glyph, bit++, 1)) {
+      repeat = fetchBits(glyph, bit, 3) + 2;
+      bit += 3;
+    }
+    bit += width;
+    rows += repeat;
+  }
+  return (bit + 7) / 8;
+}
+
+/* Splits the characters between the two dense index ranges and the sparse
+ * table. Characters are grouped into runs, bridging single missing
+ * codepoints, whose index entries cost about what a sparse table entry would.
+ * The two runs with the most characters become the ranges, which can only
+ * reach codepoint 255; everything else goes in the sparse table.
+ */
+static void chooseRanges(const std::set<uint32_t>& chars, Range& range1,
+                         Range& range2, std::vector<uint32_t>& sparse) {
+  std::vector<Range> runs;
+  std::vector<uint32_t> counts;
+  for (uint32_t c : chars) {
+    if (c > 255) {
+      continue;
+    }
+    if (!runs.empty() && c - runs.back().last <= 2) {
+      runs.back().last = c;
+      counts.back()++;
+    } else {
+      runs.push_back({c, c});
+      counts.push_back(1);
+    }
+  }
+
+  // An empty first range matches nothing and takes no entries
+  range1 = {1, 0};
+  range2 = {0, 0};
+  uint32_t first = runs.size();
+  for (uint32_t i = 0; i < runs.size(); i++) {
+    if (first == runs.size() || counts[i] > counts[first]) {
+      first = i;
+    }
+  }
+  uint32_t second = runs.size();
+  for (uint32_t i = 0; i < runs.size(); i++) {
+    if (i != first && (second == runs.size() || counts[i] > counts[second])) {
+      second = i;
+    }
+  }
+  if (first < runs.size()) {
+    range1 = runs[first];
+  }
+  if (second < runs.size()) {
+    range2 = runs[second];
+  }
+
+  for (uint32_t c : chars) {
+    bool dense = (c >= range1.first && c <= range1.last) ||
+                 (range2.last != 0 && c >= range2.first && c <= range2.last);
+    if (!dense) {
+      sparse.push_back(c);
+    }
+  }
+}
+
+static void writeBytes(std::ostream& out, const std::vector<uint8_t>& bytes) {
+  char hex[8];
+  for (uint32_t i = 0; i < bytes.size(); i++) {
+    if (i % 12 == 0) {
+      out << "    ";
+    }
+    std::snprintf(hex, sizeof(hex), "0x%02X,", bytes[i]);
+    out << hex;
+    out << ((i % 12 == 11 || i == bytes.size() - 1) ? "\n" : " ");
+  }
+}
+
+static uint32_t fullSize(const ILI9341_t3_font_t& font) {
+  uint32_t sparse = sparseCount(font);
+  uint32_t entries = denseEntries(font) + sparse;
+  uint32_t size = (entries * font.bits_index + 7) / 8;
+  if (sparse > 0) {
+    size += 2 + 2 * sparse;
+  }
+
+  std::vector<uint32_t> codepoints;
+  for (uint32_t c = font.index1_first; c <= font.index1_last; c++) {
+    codepoints.push_back(c);
+  }
+  if (font.index2_last != 0) {
+    for (uint32_t c = font.index2_first; c <= font.index2_last; c++) {
+      codepoints.push_back(c);
+    }
+  }
+  for (uint32_t i = 0; i < sparse; i++) {
+    codepoints.push_back(sparseCodepoint(font, i));
+  }
+  for (uint32_t c : codepoints) {
+    const uint8_t* glyph = findGlyph(font, c);
+    if (glyph != nullptr) {
+      size += glyphSize(font, glyph);
+    }
+  }
+  return size;
+}
+
+// Writes the subset's tables to out, returning the bytes they take
+static uint32_t writeSubset(std::ostream& out, const Subset& subset) {
+  const ILI9341_t3_font_t& font = *subset.font;
+  const std::string& name = subset.name;
+
+  Range range1;
+  Range range2;
+  std::vector<uint32_t> sparse;
+  chooseRanges(subset.chars, range1, range2, sparse);
+
+  // Index entries go in lookup order: range 1, range 2, then the sparse table
+  std::vector<uint32_t> codepoints;
+  for (uint32_t c = range1.first; c <= range1.last; c++) {
+    codepoints.push_back(c);
+  }
+  if (range2.last != 0) {
+    for (uint32_t c = range2.first; c <= range2.last; c++) {
+      codepoints.push_back(c);
+    }
+  }
+  codepoints.insert(codepoints.end(), sparse.begin(), sparse.end());
+
+  // Glyphs are copied verbatim, so their header field widths stay the same
+  std::vector<uint8_t> data{kAbsentGlyph};
+  std::vector<uint32_t> offsets;
+  for (uint32_t c : codepoints) {
+    const uint8_t* glyph = nullptr;
+    if (subset.chars.count(c) > 0) {
+      glyph = findGlyph(font, c);
+    }
+    if (glyph == nullptr) {
+      offsets.push_back(0);
+      continue;
+    }
+
+    offsets.push_back(data.size());
+    data.insert(data.end(), glyph, glyph + glyphSize(font, glyph));
+  }
+
+  uint32_t bitsIndex = 1;
+  while ((1u << bitsIndex) <= data.size()) {
+    bitsIndex++;
+  }
+  std::vector<uint8_t> index((offsets.size() * bitsIndex + 7) / 8);
+  for (uint32_t i = 0; i < offsets.size(); i++) {
+    storeBits(index, i * bitsIndex, bitsIndex, offsets[i]);
+  }
+
+  out << "static const unsigned char " << name << "_data[] = {\n";
+  writeBytes(out, data);
+  out << "};\n/* font data size: " << data.size() << " bytes */\n\n";
+  out << "static const unsigned char " << name << "_index[] = {\n";
+  writeBytes(out, index);
+  out << "};\n/* font index size: " << index.size() << " bytes */\n\n";
+
+  std::vector<uint8_t> unicode;
+  if (!sparse.empty()) {
+    unicode.push_back(sparse.size() >> 8);
+    unicode.push_back(sparse.size() & 0xFF);
+    for (uint32_t c : sparse) {
+      unicode.push_back(c >> 8);
+      unicode.push_back(c & 0xFF);
+    }
+    out << "static const unsigned char " << name << "_unicode[] = {\n";
+    writeBytes(out, unicode);
+    out << "};\n/* font unicode size: " << unicode.size() << " bytes */\n\n";
+  }
+
+  const uint32_t fields[] = {font.version,      font.reserved,
+                             range1.first,      range1.last,
+                             range2.first,      range2.last,
+                             bitsIndex,         font.bits_width,
+                             font.bits_height,  font.bits_xoffset,
+                             font.bits_yoffset, font.bits_delta,
+                             font.line_space,   font.cap_height};
+  out << "const ILI9341_t3_font_t " << name << " = {" << name << "_index, "
+      << (sparse.empty() ? "0" : name + "_unicode") << ", " << name
+      << "_data";
+  for (uint32_t field : fields) {
+    out << ", " << field;
+  }
+  out << "};\n\n";
+
+  return data.size() + index.size() + unicode.size();
+}
+
+static bool readManifest(const char* path, std::vector<Subset>& subsets) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+
+  std::string line;
+  uint32_t lineNum = 0;
+  while (std::getline(in, line)) {
+    lineNum++;
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream fields(line);
+    Subset subset;
+    std::string fontName;
+    fields >> subset.name >> fontName;
+    subset.font = findFont(fontName);
+    if (subset.font == nullptr) {
+      std::fprintf(stderr, "%s:%u: unknown font '%s'\n", path, lineNum,
+                   fontName.c_str());
+      return false;
+    }
+
+    // Skip the one space separating the characters from the font name
+    fields.get();
+    std::string chars;
+    std::getline(fields, chars);
+    uint32_t c = 0;
+    uint8_t pending = 0;
+    for (char byte : chars) {
+      if (!decodeUtf8(byte, c, pending)) {
+        continue;
+      }
+      if (c > 0xFFFF || findGlyph(*subset.font, c) == nullptr) {
+        std::fprintf(stderr, "%s:%u: %s has no glyph for U+%04X\n", path,
+                     lineNum, fontName.c_str(), c);
+        return false;
+      }
+      subset.chars.insert(c);
+    }
+    if (subset.chars.empty()) {
+      std::fprintf(stderr, "%s:%u: no characters\n", path, lineNum);
+      return false;
+    }
+
+    subsets.push_back(std::move(subset));
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::fprintf(stderr, "usage: %s <manifest> <output path>\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Subset> subsets;
+  if (!readManifest(argv[1], subsets)) {
+    return 1;
+  }
+
+  std::string base = argv[2];
+  std::string guard = base.substr(base.find_last_of('/') + 1);
+  std::ofstream header(base + ".h");
+  std::ofstream source(base + ".c");
+  if (!header || !source) {
+    std::fprintf(stderr, "can't write %s.{h,c}\n", base.c_str());
+    return 1;
+  }
+
+  header << "// Generated by tools/FontSubset.cpp from " << argv[1]
+         << "; do not edit.\n\n"
+         << "#ifndef _ILI9341_t3_" << guard << "_\n"
+         << "#define _ILI9341_t3_" << guard << "_\n\n"
+         << "#include \"ILI9341_t3.h\"\n\n"
+         << "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n";
+  source << "// Generated by tools/FontSubset.cpp from " << argv[1]
+         << "; do not edit.\n\n"
+         << "#include \"" << guard << ".h\"\n\n";
+
+  for (const auto& subset : subsets) {
+    header << "extern const ILI9341_t3_font_t " << subset.name << ";\n";
+    uint32_t size = writeSubset(source, subset);
+    std::printf("%-20s %3zu chars %7u -> %6u bytes\n", subset.name.c_str(),
+                subset.chars.size(), fullSize(*subset.font), size);
+  }
+
+  header << "\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n#endif\n";
+  return 0;
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2016-2017 Formula Slug. All Rights Reserved.
+
+/* @desc Sprite conversion tool. Reads a manifest of images drawn as text and
+ *       writes them as run-length encoded ILI9341_t3 sprites.
+ *
+ *       Usage: sprite_convert <manifest> <output path without extension>
+ *
+ *       Each sprite starts with a "sprite <name>" line, followed by a
+ *       "color <character> <RRGGBB>" line for each character its image uses,
+ *       where "none" in place of the color makes that character transparent.
+ *       The image's rows follow, one character per pixel, up to a blank line
+ *       or the end of the file. Lines starting with '#' are ignored outside
+ *       images.
+ */
+
+#include <stdint.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Matches the sprite format in ILI9341_t3.h
+constexpr uint32_t kMaxColors = 16;
+constexpr uint32_t kShortRun = 15;
+constexpr uint32_t kMaxRun = 16 + 255;
+constexpr uint8_t kOpaque = 0xFF;
+
+struct Sprite {
+  std::string name;
+  std::vector<uint16_t> palette;
+  uint8_t transparent = kOpaque;
+  std::map<char, uint8_t> indices;
+  std::vector<std::string> rows;
+};
+
+static uint16_t color565(uint32_t rgb) {
+  uint32_t r = (rgb >> 16) & 0xFF;
+  uint32_t g = (rgb >> 8) & 0xFF;
+  uint32_t b = rgb & 0xFF;
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+static bool readManifest(const char* path, std::vector<Sprite>& sprites) {
+  std::ifstream in(path);
+  if (!in) {
+    std::fprintf(stderr, "can't open %s\n", path);
+    return false;
+  }
+
+  std::string line;
+  uint32_t lineNum = 0;
+  Sprite* sprite = nullptr;
+  while (std::getline(in, line)) {
+    lineNum++;
+    if (line.empty()) {
+      sprite = nullptr;
+      continue;
+    }
+    if (sprite != nullptr && !sprite->rows.empty()) {
+      if (line.size() != sprite->rows[0].size()) {
+        std::fprintf(stderr, "%s:%u: row isn't %zu pixels wide\n", path,
+                     lineNum, sprite->rows[0].size());
+        return false;
+      }
+      sprite->rows.push_back(line);
+      continue;
+    }
+    if (line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream fields(line);
+    std::string keyword;
+    fields >> keyword;
+    if (keyword == "sprite") {
+      sprites.emplace_back();
+      sprite = &sprites.back();
+      fields >> sprite->name;
+      continue;
+    }
+    if (sprite == nullptr) {
+      std::fprintf(stderr, "%s:%u: expected \"sprite <name>\"\n", path,
+                   lineNum);
+      return false;
+    }
+
+    if (keyword == "color") {
+      std::string character;
+      std::string color;
+      fields >> character >> color;
+      if (character.size() != 1 || sprite->palette.size() == kMaxColors) {
+        std::fprintf(stderr, "%s:%u: bad color, or more than %u\n", path,
+                     lineNum, kMaxColors);
+        return false;
+      }
+      sprite->indices[character[0]] = sprite->palette.size();
+      if (color == "none") {
+        sprite->transparent = sprite->palette.size();
+        sprite->palette.push_back(0);
+      } else {
+        sprite->palette.push_back(color565(std::stoul(color, nullptr, 16)));
+      }
+      continue;
+    }
+
+    // Anything else starts the image
+    sprite->rows.push_back(line);
+  }
+
+  for (const auto& s : sprites) {
+    if (s.rows.empty()) {
+      std::fprintf(stderr, "%s: sprite %s has no image\n", path,
+                   s.name.c_str());
+      return false;
+    }
+    for (const auto& row : s.rows) {
+      for (char c : row) {
+        if (s.indices.count(c) == 0) {
+          std::fprintf(stderr, "%s: sprite %s uses '%c' without a color\n",
+                       path, s.name.c_str(), c);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Writes bytes as the body of a C array initializer, twelve to a line
+static void writeBytes(std::ostream& out, const std::vector<uint8_t>& bytes) {
+  for (uint32_t i = 0; i < bytes.size(); i++) {
+    char hex[8];
+    std::snprintf(hex, sizeof(hex), "0x%02X,", bytes[i]);
+    out << (i % 12 == 0 ? "    " : " ") << hex;
+    if (i % 12 == 11 || i + 1 == bytes.size()) {
+      out << '\n';
+    }
+  }
+}
+
+static void appendRun(std::vector<uint8_t>& data, uint8_t index,
+                      uint32_t length) {
+  if (length <= kShortRun) {
+    data.push_back((length - 1) << 4 | index);
+  } else {
+    data.push_back(kShortRun << 4 | index);
+    data.push_back(length - 16);
+  }
+}
+
+// Returns the size of the sprite's data and palette
+static uint32_t writeSprite(std::ostream& out, const Sprite& sprite) {
+  // Runs carry on from one row to the next
+  std::vector<uint8_t> data;
+  uint8_t runIndex = 0;
+  uint32_t runLength = 0;
+  for (const auto& row : sprite.rows) {
+    for (char c : row) {
+      uint8_t index = sprite.indices.at(c);
+      if (runLength > 0 && (index != runIndex || runLength == kMaxRun)) {
+        appendRun(data, runIndex, runLength);
+        runLength = 0;
+      }
+      runIndex = index;
+      runLength++;
+    }
+  }
+  appendRun(data, runIndex, runLength);
+
+  const std::string& name = sprite.name;
+  out << "static const unsigned char " << name << "_data[] = {\n";
+  writeBytes(out, data);
+  out << "};\n\n";
+  out << "static const unsigned short " << name << "_palette[] = {";
+  for (uint32_t i = 0; i < sprite.palette.size(); i++) {
+    char hex[8];
+    std::snprintf(hex, sizeof(hex), "0x%04X", sprite.palette[i]);
+    out << (i > 0 ? ", " : "") << hex;
+  }
+  out << "};\n\n";
+
+  uint32_t width = sprite.rows[0].size();
+  uint32_t height = sprite.rows.size();
+  out << "const ILI9341_t3_sprite_t " << name << " = {" << name << "_data, "
+      << name << "_palette, " << width << ", " << height << ", "
+      << static_cast<uint32_t>(sprite.transparent) << "};\n"
+      << "/* " << width << "x" << height << ", "
+      << data.size() + 2 * sprite.palette.size() << " bytes */\n\n";
+
+  return data.size() + 2 * sprite.palette.size();
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::fprintf(stderr, "usage: %s <manifest> <output path>\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<Sprite> sprites;
+  if (!readManifest(argv[1], sprites)) {
+    return 1;
+  }
+
+  std::string base = argv[2];
+  std::string guard = base.substr(base.find_last_of('/') + 1);
+  std::ofstream header(base + ".h");
+  std::ofstream source(base + ".c");
+  if (!header || !source) {
+    std::fprintf(stderr, "can't write %s.{h,c}\n", base.c_str());
+    return 1;
+  }
+
+  header << "// Generated by tools/SpriteConvert.cpp from " << argv[1]
+         << "; do not edit.\n\n"
+         << "#ifndef _ILI9341_t3_" << guard << "_\n"
+         << "#define _ILI9341_t3_" << guard << "_\n\n"
+         << "#include \"ILI9341_t3.h\"\n\n"
+         << "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n";
+  source << "// Generated by tools/SpriteConvert.cpp from " << argv[1]
+         << "; do not edit.\n\n"
+         << "#include \"" << guard << ".h\"\n\n";
+
+  for (const auto& sprite : sprites) {
+    header << "extern const ILI9341_t3_sprite_t " << sprite.name << ";\n";
+    uint32_t size = writeSprite(source, sprite);
+    uint32_t pixels = sprite.rows[0].size() * sprite.rows.size();
+    std::printf("%-20s %7u -> %6u bytes\n", sprite.name.c_str(), 2 * pixels,
+                size);
+  }
+
+  header << "\n#ifdef __cplusplus\n}  // extern \"C\"\n#endif\n\n#endif\n";
+  return 0;
+}